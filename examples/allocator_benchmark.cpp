@@ -0,0 +1,220 @@
+#include <cat/chained_arena_allocator>
+#include <cat/concurrent_pool_allocator>
+#include <cat/format>
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+#include <cat/pool_allocator>
+#include <cat/size_class_allocator>
+#include <cat/slab_allocator>
+#include <cat/string>
+#include <cat/thread>
+#include <cat/vec>
+
+using namespace cat::literals;
+using namespace cat::integers;
+
+namespace {
+
+constexpr idx iterations = 100'000u;
+constexpr idx batch_size = 64u;
+
+struct small_object {
+   cat::byte storage[48];
+};
+
+// Read the CPU's timestamp counter.
+auto
+cycles() -> uint8 {
+   return __builtin_ia32_rdtsc();
+}
+
+void
+report(cat::str_view name, cat::str_view workload, uint8 elapsed_cycles,
+       idx operations = iterations) {
+   cat::page_allocator pager;
+   cat::span page = pager.xalloc_multi<cat::byte>(4_uki);
+   auto allocator = cat::make_linear_allocator(page);
+   cat::print(cat::fmt(allocator, "{}, {}: {} cycles per operation\n", name,
+                       workload, elapsed_cycles / operations)
+                 .verify())
+      .verify();
+   pager.free(page);
+}
+
+// Allocate batches of small objects, then free them, and call
+// `after_batch()` between each batch.
+void
+bench_churn(cat::str_view name, auto& allocator, auto after_batch) {
+   small_object* objects[batch_size.raw];
+   uint8 const begin = cycles();
+   for (idx i; i < iterations; i += batch_size) {
+      for (idx j; j < batch_size; ++j) {
+         objects[j.raw] = allocator.template xalloc<small_object>();
+      }
+      for (idx j; j < batch_size; ++j) {
+         allocator.free(objects[j.raw]);
+      }
+      after_batch();
+   }
+   report(name, "small object churn", cycles() - begin);
+}
+
+// Grow a `vec` one element at a time.
+void
+bench_vec_growth(cat::str_view name, auto& allocator) {
+   uint8 const begin = cycles();
+   cat::vec numbers = cat::make_vec<int4>(allocator);
+   for (idx i; i < iterations; ++i) {
+      numbers.push_back(int4(i)).verify();
+   }
+   report(name, "vec growth", cycles() - begin);
+}
+
+using shared_pool = cat::concurrent_pool_allocator<sizeof(small_object)>;
+
+// Threads cannot take arguments yet, so they share this global.
+constinit shared_pool* p_shared_pool = nullptr;
+
+[[gnu::no_sanitize_address]]
+void
+churn_shared_pool() {
+   small_object* objects[batch_size.raw];
+   for (idx i; i < iterations; i += batch_size) {
+      for (idx j; j < batch_size; ++j) {
+         objects[j.raw] = p_shared_pool->xalloc<small_object>();
+      }
+      for (idx j; j < batch_size; ++j) {
+         p_shared_pool->free(objects[j.raw]);
+      }
+   }
+}
+
+// Churn one shared pool from several threads at once.
+void
+bench_concurrent_churn(cat::page_allocator& pager) {
+   constexpr idx max_threads = 8u;
+   cat::span pool_page = pager.xalloc_multi<cat::byte>(
+      max_threads * batch_size * sizeof(small_object));
+   shared_pool pool = cat::make_concurrent_pool_allocator<sizeof(small_object)>(
+      pool_page);
+   p_shared_pool = &pool;
+
+   for (idx thread_count = 1u; thread_count <= max_threads;
+        thread_count *= 2u) {
+      cat::thread threads[max_threads.raw];
+      uint8 const begin = cycles();
+      for (idx i; i < thread_count; ++i) {
+         threads[i.raw]
+            .spawn(pager, 64_uki, 4_uki, &churn_shared_pool)
+            .verify();
+      }
+      for (idx i; i < thread_count; ++i) {
+         threads[i.raw].join().verify();
+      }
+      cat::page_allocator report_pager;
+      cat::span page = report_pager.xalloc_multi<cat::byte>(4_uki);
+      auto allocator = cat::make_linear_allocator(page);
+      report(cat::fmt(allocator, "concurrent_pool_allocator ({} threads)",
+                      thread_count)
+                .verify(),
+             "shared small object churn", cycles() - begin,
+             iterations * thread_count);
+      report_pager.free(page);
+   }
+   pager.free(pool_page);
+}
+
+constinit cat::size_class_allocator* p_shared_size_classes = nullptr;
+
+[[gnu::no_sanitize_address]]
+void
+churn_shared_size_classes() {
+   small_object* objects[batch_size.raw];
+   for (idx i; i < iterations; i += batch_size) {
+      for (idx j; j < batch_size; ++j) {
+         objects[j.raw] = p_shared_size_classes->xalloc<small_object>();
+      }
+      for (idx j; j < batch_size; ++j) {
+         p_shared_size_classes->free(objects[j.raw]);
+      }
+   }
+   p_shared_size_classes->flush_thread_cache();
+}
+
+// Churn one shared `size_class_allocator` from several threads at once. Each
+// thread allocates from its own cache, so this should scale with the number
+// of threads.
+void
+bench_concurrent_size_classes(cat::page_allocator& pager) {
+   constexpr idx max_threads = 8u;
+   cat::size_class_allocator size_classes;
+   p_shared_size_classes = &size_classes;
+
+   for (idx thread_count = 1u; thread_count <= max_threads;
+        thread_count *= 2u) {
+      cat::thread threads[max_threads.raw];
+      uint8 const begin = cycles();
+      for (idx i; i < thread_count; ++i) {
+         threads[i.raw]
+            .spawn(pager, 64_uki, 4_uki, &churn_shared_size_classes)
+            .verify();
+      }
+      for (idx i; i < thread_count; ++i) {
+         threads[i.raw].join().verify();
+      }
+      cat::page_allocator report_pager;
+      cat::span page = report_pager.xalloc_multi<cat::byte>(4_uki);
+      auto allocator = cat::make_linear_allocator(page);
+      report(cat::fmt(allocator, "size_class_allocator ({} threads)",
+                      thread_count)
+                .verify(),
+             "shared small object churn", cycles() - begin,
+             iterations * thread_count);
+      report_pager.free(page);
+   }
+}
+
+}  // namespace
+
+auto
+main() -> int {
+   cat::page_allocator pager;
+   bench_churn("page_allocator", pager, [] {
+   });
+   bench_vec_growth("page_allocator", pager);
+
+   cat::size_class_allocator size_classes;
+   bench_churn("size_class_allocator", size_classes, [] {
+   });
+   bench_vec_growth("size_class_allocator", size_classes);
+
+   cat::span pool_page =
+      pager.xalloc_multi<cat::byte>(batch_size * sizeof(small_object));
+   auto pool = cat::make_pool_allocator<sizeof(small_object)>(pool_page);
+   bench_churn("pool_allocator", pool, [] {
+   });
+   pager.free(pool_page);
+
+   auto slab = cat::make_slab_allocator<sizeof(small_object)>();
+   bench_churn("slab_allocator", slab, [] {
+   });
+
+   cat::span linear_page = pager.xalloc_multi<cat::byte>(16_umi);
+   auto linear = cat::make_linear_allocator(linear_page);
+   bench_churn("linear_allocator", linear, [&] {
+      linear.reset();
+   });
+   linear.reset();
+   bench_vec_growth("linear_allocator", linear);
+   pager.free(linear_page);
+
+   auto arena = cat::make_chained_arena_allocator(pager);
+   bench_churn("chained_arena_allocator", arena, [&] {
+      arena.reset();
+   });
+   arena.reset();
+   bench_vec_growth("chained_arena_allocator", arena);
+
+   bench_concurrent_churn(pager);
+   bench_concurrent_size_classes(pager);
+}
@@ -0,0 +1,86 @@
+#include <cat/format>
+#include <cat/hash>
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+#include <cat/string>
+
+using namespace cat::literals;
+using namespace cat::integers;
+
+namespace {
+
+constexpr idx total_bytes = 64_umi;
+constexpr idx input_sizes[] = {4u,   8u,    16u,   32u,    64u,  128u,
+                               256u, 1_uki, 4_uki, 64_uki, 1_umi};
+
+// Read the CPU's timestamp counter.
+auto
+cycles() -> uint8 {
+   return __builtin_ia32_rdtsc();
+}
+
+void
+report(cat::str_view workload, idx input_bytes, uint8 elapsed_cycles,
+       idx operations) {
+   cat::page_allocator pager;
+   cat::span page = pager.xalloc_multi<cat::byte>(4_uki);
+   auto allocator = cat::make_linear_allocator(page);
+   // Throughput is reported in bytes per 100 cycles, to keep it integral.
+   cat::print(cat::fmt(allocator,
+                       "{}, {} bytes: {} cycles per hash, {} bytes per 100 "
+                       "cycles\n",
+                       workload, input_bytes, elapsed_cycles / operations,
+                       (operations * input_bytes * 100u) / elapsed_cycles)
+                 .verify())
+      .verify();
+   pager.free(page);
+}
+
+// Hash the same amount of data at every input size. Each hash seeds the
+// next one, so that the hashes cannot be hoisted out of the loop.
+void
+bench_hash_bytes(cat::span<char> buffer) {
+   for (idx input_bytes : input_sizes) {
+      idx const operations = total_bytes / input_bytes;
+      uword seed = 0u;
+      uint8 const begin = cycles();
+      for (idx i; i < operations; ++i) {
+         // Step through the buffer, so that short inputs are not always
+         // read from the same cache line.
+         idx const offset = (i * 64u) % (buffer.size() - input_bytes);
+         seed = cat::hash_bytes(buffer.data() + offset.raw, input_bytes, seed);
+      }
+      uint8 const elapsed = cycles() - begin;
+      cat::verify(seed != 0u);
+      report("hash_bytes", input_bytes, elapsed, operations);
+   }
+}
+
+// Hash consecutive integers, as a `hash_map` with integer keys would.
+void
+bench_hash_integer() {
+   constexpr idx operations = 16_umi;
+   uword sink = 0u;
+   uint8 const begin = cycles();
+   for (idx i; i < operations; ++i) {
+      sink ^= cat::hash_integer(i);
+   }
+   uint8 const elapsed = cycles() - begin;
+   cat::verify(sink != 0u);
+   report("hash_integer", idx(sizeof(idx)), elapsed, operations);
+}
+
+}  // namespace
+
+auto
+main() -> int {
+   cat::page_allocator pager;
+   cat::span buffer = pager.xalloc_multi<char>(2_umi);
+   for (idx i; i < buffer.size(); ++i) {
+      buffer[i] = static_cast<char>(i.raw * 131u);
+   }
+
+   bench_hash_bytes(buffer);
+   bench_hash_integer();
+   pager.free(buffer);
+}
@@ -0,0 +1,142 @@
+#include <cat/atomic>
+#include <cat/bit>
+#include <cat/format>
+#include <cat/linear_allocator>
+#include <cat/linux>
+#include <cat/mpmc_queue>
+#include <cat/page_allocator>
+#include <cat/string>
+#include <cat/thread>
+
+using namespace cat::literals;
+using namespace cat::integers;
+
+namespace {
+
+using queue_type = cat::mpmc_queue<uword, cat::page_allocator>;
+
+constexpr idx message_count = 1'000'000u;
+constexpr idx max_threads = 32u;
+
+// Threads cannot take arguments yet, so they share these globals.
+constinit queue_type* p_shared_queue = nullptr;
+constinit cat::atomic<uword::raw_type> messages_per_producer = 0u;
+constinit cat::atomic<uword::raw_type> remaining_messages = 0u;
+constinit cat::atomic<bool> is_started = false;
+
+// Read the CPU's timestamp counter.
+auto
+cycles() -> uint8 {
+   return __builtin_ia32_rdtsc();
+}
+
+// Count the CPUs that this process may run on.
+auto
+count_cores() -> idx {
+   cat::byte mask_storage[128];
+   cat::span<cat::byte> cpu_mask = {mask_storage, 128u};
+   idx const mask_bytes =
+      nix::sys_sched_getaffinity(nix::process_id{0}, cpu_mask).or_exit();
+   idx cores;
+   for (idx i; i < mask_bytes; ++i) {
+      cores += idx(cat::popcount(mask_storage[i.raw].value));
+   }
+   return cores;
+}
+
+[[gnu::no_sanitize_address]]
+void
+produce() {
+   while (!is_started.load(cat::memory_order::acquire)) {
+      cat::relax_cpu();
+   }
+   uword::raw_type const count = messages_per_producer.load();
+   for (uword::raw_type i = 0u; i < count; ++i) {
+      p_shared_queue->push(i);
+   }
+}
+
+[[gnu::no_sanitize_address]]
+void
+consume() {
+   while (!is_started.load(cat::memory_order::acquire)) {
+      cat::relax_cpu();
+   }
+   while (remaining_messages.load(cat::memory_order::relaxed) > 0u) {
+      if (p_shared_queue->try_pop().has_value()) {
+         --remaining_messages;
+      } else {
+         cat::relax_cpu();
+      }
+   }
+}
+
+// Pass `message_count` messages through one queue from `producer_count`
+// threads to `consumer_count` threads.
+void
+bench_queue(cat::page_allocator& pager, idx producer_count,
+            idx consumer_count) {
+   queue_type queue = cat::make_mpmc_queue<uword>(pager, 1_uki).verify();
+   p_shared_queue = &queue;
+   messages_per_producer = (message_count / producer_count).raw;
+   idx const total_messages = (message_count / producer_count) * producer_count;
+   remaining_messages = total_messages.raw;
+   is_started = false;
+
+   cat::thread producers[max_threads.raw];
+   cat::thread consumers[max_threads.raw];
+   for (idx i; i < producer_count; ++i) {
+      producers[i.raw].spawn(pager, 64_uki, 4_uki, &produce).verify();
+   }
+   for (idx i; i < consumer_count; ++i) {
+      consumers[i.raw].spawn(pager, 64_uki, 4_uki, &consume).verify();
+   }
+
+   uint8 const begin = cycles();
+   is_started.store(true, cat::memory_order::release);
+   for (idx i; i < producer_count; ++i) {
+      producers[i.raw].join().verify();
+   }
+   for (idx i; i < consumer_count; ++i) {
+      consumers[i.raw].join().verify();
+   }
+   uint8 const elapsed = cycles() - begin;
+
+   cat::span page = pager.xalloc_multi<cat::byte>(4_uki);
+   auto allocator = cat::make_linear_allocator(page);
+   cat::print(cat::fmt(allocator,
+                       "mpmc_queue, {} producers, {} consumers: {} cycles per "
+                       "message\n",
+                       producer_count, consumer_count,
+                       elapsed / total_messages)
+                 .verify())
+      .verify();
+   pager.free(page);
+}
+
+// Double a count of threads, but stop at `cores` rather than skipping past
+// it, so that every core is measured when `cores` is not a power of 2.
+auto
+next_thread_count(idx count, idx cores) -> idx {
+   if (count == cores) {
+      return cores + 1u;
+   }
+   return cat::min(count * 2u, cores);
+}
+
+}  // namespace
+
+auto
+main() -> int {
+   cat::page_allocator pager;
+   idx const cores = cat::min(count_cores(), max_threads);
+
+   // Double the producers and consumers up to the number of cores.
+   for (idx producers = 1u; producers <= cores;
+        producers = next_thread_count(producers, cores)) {
+      for (idx consumers = 1u; consumers <= cores;
+           consumers = next_thread_count(consumers, cores)) {
+         bench_queue(pager, producers, consumers);
+      }
+   }
+}
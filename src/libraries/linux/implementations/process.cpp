@@ -1,21 +1,125 @@
 #include <cat/linux>
 
+// The linker defines this symbol at the start of the program's ELF header.
+extern "C" [[gnu::visibility("hidden")]] cat::byte const __ehdr_start[];
+
+namespace {
+
+// The initialization image of the program's `thread_local` variables. The
+// first `data_bytes` are copied from `.tdata`, and the rest is `.tbss`.
+struct static_tls_image {
+   cat::byte const* p_data = nullptr;
+   cat::idx data_bytes;
+   cat::idx total_bytes;
+   cat::idx alignment = 1u;
+};
+
+// Read a little-endian integer from an ELF header at `offset` bytes.
+template <typename T>
+auto
+read_elf(cat::byte const* p_header, cat::idx offset) -> T {
+   T value;
+   __builtin_memcpy(&value, p_header + offset.raw, sizeof(T));
+   return value;
+}
+
+// Find the `PT_TLS` program header of this executable, if it has one.
+auto
+find_static_tls_image() -> static_tls_image {
+   constexpr cat::uint4 pt_load = 1u;
+   constexpr cat::uint4 pt_tls = 7u;
+
+   cat::byte const* p_elf = __ehdr_start;
+   cat::byte const* p_program_headers =
+      p_elf + read_elf<cat::uint8>(p_elf, 32u).raw;
+   cat::idx const header_bytes = read_elf<cat::uint2>(p_elf, 54u);
+   cat::idx const header_count = read_elf<cat::uint2>(p_elf, 56u);
+
+   // A position-independent executable is loaded at some offset from its
+   // virtual addresses, so the `PT_TLS` segment is found relative to the
+   // segment which maps the ELF header.
+   cat::uint8 elf_address = 0u;
+   for (cat::idx i; i < header_count; ++i) {
+      cat::byte const* p_header = p_program_headers + (i * header_bytes).raw;
+      if (read_elf<cat::uint4>(p_header, 0u) == pt_load
+          && read_elf<cat::uint8>(p_header, 8u) == 0u) {
+         elf_address = read_elf<cat::uint8>(p_header, 16u);
+         break;
+      }
+   }
+
+   for (cat::idx i; i < header_count; ++i) {
+      cat::byte const* p_header = p_program_headers + (i * header_bytes).raw;
+      if (read_elf<cat::uint4>(p_header, 0u) != pt_tls) {
+         continue;
+      }
+      cat::uint8 const alignment = read_elf<cat::uint8>(p_header, 48u);
+      return {
+         .p_data = p_elf
+                   + (read_elf<cat::uint8>(p_header, 16u) - elf_address).raw,
+         .data_bytes = read_elf<cat::uint8>(p_header, 32u),
+         .total_bytes = read_elf<cat::uint8>(p_header, 40u),
+         .alignment = (alignment > 1u) ? cat::idx(alignment) : cat::idx(1u),
+      };
+   }
+   return {};
+}
+
+}  // namespace
+
 // The child thread exits with a false-positive from asan.
 [[gnu::no_sanitize_address]]
 auto
 nix::process::spawn_impl(cat::uintptr<void> stack, cat::idx initial_stack_size,
                          cat::idx thread_local_buffer_size, void* p_function,
                          void* p_args_struct) -> scaredy_nix<void> {
+   static_tls_image const tls_image = find_static_tls_image();
+
    m_stack_size = initial_stack_size;
    m_p_stack_bottom = stack.get();
 
    // We need the top because memory will be pushed to it downwards on
-   // x86-64.
-   cat::uintptr<void> stack_top =
-      stack + m_stack_size + thread_local_buffer_size;
+   // x86-64. The thread-local buffer begins here.
+   cat::uintptr<void> stack_top = stack + m_stack_size;
+
+   // Lay out the thread-local buffer as this thread's copy of the `PT_TLS`
+   // segment, then the thread control block that `%fs` will point to, then
+   // the scratch arena. The control block is aligned to the segment, so that
+   // the segment's variables are aligned at their fixed negative offsets.
+   cat::idx const tls_alignment =
+      cat::max(tls_image.alignment, cat::idx(alignof(thread_control_block)));
+   cat::idx const tls_bytes =
+      cat::div_ceil(tls_image.total_bytes, tls_image.alignment)
+      * tls_image.alignment;
+   cat::uintptr<void> const tls_buffer =
+      cat::align_up(stack_top + tls_bytes, cat::uword(tls_alignment.raw));
+   cat::uintptr<void> const scratch = tls_buffer + sizeof(thread_control_block);
+   cat::uintptr<void> const buffer_end = stack_top + thread_local_buffer_size;
+
+   // The thread-local buffer must hold at least the `PT_TLS` segment and a
+   // thread control block, or `thread_local` variables would overwrite
+   // this thread's stack.
+   if (scratch > buffer_end) {
+      return linux_error::inval;
+   }
+
+   cat::byte* p_tls_block =
+      static_cast<cat::byte*>((tls_buffer - tls_bytes).get());
+   cat::copy_memory(tls_image.p_data, p_tls_block, tls_image.data_bytes);
+   cat::zero_memory(p_tls_block + tls_image.data_bytes.raw,
+                    tls_bytes - tls_image.data_bytes);
 
-   cat::uintptr<void> tls_buffer = stack_top;
-   stack_top -= thread_local_buffer_size;
+   thread_control_block* p_control_block =
+      new (tls_buffer.get()) thread_control_block{
+         .p_self = nullptr,
+         .stack_guard = 0u,
+         .scratch = cat::make_linear_allocator(
+            scratch, static_cast<cat::idx>(buffer_end - scratch)),
+         .magic = thread_control_block::magic_value,
+         .p_allocator_cache = nullptr,
+         .allocator_cache_owner = 0u,
+      };
+   p_control_block->p_self = p_control_block;
 
    // TODO: 32 byte alignment is required for AVX2 support.
    // stack_top = cat::align_down(stack_top - 16, 32u);
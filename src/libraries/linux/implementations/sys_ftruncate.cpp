@@ -0,0 +1,9 @@
+#include <cat/linux>
+
+// `nix::sys_ftruncate()` wraps the `ftruncate` Linux syscall. This resizes an
+// open file, filling any new bytes with zeros.
+auto
+nix::sys_ftruncate(nix::file_descriptor file_descriptor, cat::idx length)
+   -> nix::scaredy_nix<void> {
+   return nix::syscall<void>(77, file_descriptor, length);
+}
@@ -0,0 +1,9 @@
+#include <cat/linux>
+
+// `nix::sys_madvise()` wraps the `madvise` Linux syscall. This hints to the
+// kernel how a range of pages will be used.
+auto
+nix::sys_madvise(void const* p_memory, cat::uword length,
+                 nix::memory_advice advice) -> nix::scaredy_nix<void> {
+   return nix::syscall<void>(28, p_memory, length, advice);
+}
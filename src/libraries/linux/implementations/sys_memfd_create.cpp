@@ -0,0 +1,10 @@
+#include <cat/linux>
+
+// `nix::sys_memfd_create()` wraps the `memfd_create` Linux syscall. This
+// creates an anonymous file that lives in memory, which can be mapped like
+// any other file. `p_name` is only shown in `/proc/self/fd/`.
+auto
+nix::sys_memfd_create(char const* p_name, memfd_flags flags)
+   -> scaredy_nix<file_descriptor> {
+   return syscall<file_descriptor>(319, p_name, flags);
+}
@@ -0,0 +1,10 @@
+#include <cat/linux>
+
+// `nix::sys_mprotect()` wraps the `mprotect` Linux syscall. This changes the
+// access protections of a range of pages.
+auto
+nix::sys_mprotect(void const* p_memory, cat::uword length,
+                  nix::memory_protection_flags protections)
+   -> nix::scaredy_nix<void> {
+   return nix::syscall<void>(10, p_memory, length, protections);
+}
@@ -0,0 +1,11 @@
+#include <cat/linux>
+
+// `nix::sys_mremap()` wraps the `mremap` Linux syscall. This returns the
+// virtual memory address of the resized mapping.
+auto
+nix::sys_mremap(void const* p_memory, cat::uword old_length,
+                cat::uword new_length, nix::remap_flags flags,
+                void* p_new_address) -> nix::scaredy_nix<void*> {
+   return nix::syscall<void*>(25, p_memory, old_length, new_length, flags,
+                              p_new_address);
+}
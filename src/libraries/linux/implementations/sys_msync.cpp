@@ -0,0 +1,9 @@
+#include <cat/linux>
+
+// `nix::sys_msync()` wraps the `msync` Linux syscall. This writes the dirty
+// pages of a shared file mapping back to that file.
+auto
+nix::sys_msync(void const* p_memory, cat::uword length,
+               nix::memory_sync_flags flags) -> nix::scaredy_nix<void> {
+   return nix::syscall<void>(26, p_memory, length, flags);
+}
@@ -0,0 +1,11 @@
+#include <cat/linux>
+
+// `nix::sys_sched_getaffinity()` wraps the `sched_getaffinity` Linux syscall.
+// This writes a bitmask of the CPUs that `pid` may run on into `cpu_mask`,
+// and returns how many bytes of it were written. A `pid` of `0` is the
+// calling thread.
+auto
+nix::sys_sched_getaffinity(process_id pid, cat::span<cat::byte> cpu_mask)
+   -> scaredy_nix<cat::idx> {
+   return syscall<cat::idx>(204, pid, cpu_mask.size(), cpu_mask.data());
+}
@@ -0,0 +1,8 @@
+#include <cat/linux>
+
+// `nix::sys_sched_yield()` wraps the `sched_yield` Linux syscall. This gives
+// up the rest of the calling thread's time slice.
+auto
+nix::sys_sched_yield() -> scaredy_nix<void> {
+   return syscall<void>(24);
+}
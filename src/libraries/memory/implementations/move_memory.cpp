@@ -0,0 +1,106 @@
+#include <cat/memory>
+#include <cat/simd>
+
+namespace {
+using move_vector = cat::int8x_;
+
+// Overlapping regions are moved four vectors at a time.
+constexpr cat::uword move_step_bytes = sizeof(move_vector) * 4u;
+
+// Move bytes from the lowest address up. This is correct when the destination
+// is below the source, because each block is loaded whole before it is
+// stored, and a store can then only overwrite source bytes which were
+// already loaded.
+[[gnu::optimize("-fno-tree-loop-distribute-patterns"),
+  clang::no_builtin("memmove")]]
+void
+move_forwards(unsigned char const* p_source, unsigned char* p_destination,
+              cat::uword bytes) {
+   move_vector vectors[4];
+   while (bytes >= move_step_bytes) {
+      __builtin_memcpy(&vectors, p_source, sizeof(vectors));
+      __builtin_memcpy(p_destination, &vectors, sizeof(vectors));
+      p_source += move_step_bytes.raw;
+      p_destination += move_step_bytes.raw;
+      bytes -= move_step_bytes;
+   }
+
+   while (bytes >= sizeof(cat::uword)) {
+      cat::uword::raw_type word;
+      __builtin_memcpy(&word, p_source, sizeof(word));
+      __builtin_memcpy(p_destination, &word, sizeof(word));
+      p_source += sizeof(word);
+      p_destination += sizeof(word);
+      bytes -= sizeof(word);
+   }
+
+   while (bytes > 0u) {
+      *p_destination = *p_source;
+      ++p_source;
+      ++p_destination;
+      bytes -= 1u;
+   }
+}
+
+// Move bytes from the highest address down. This is correct when the
+// destination is above the source, for the same reason as `move_forwards()`.
+[[gnu::optimize("-fno-tree-loop-distribute-patterns"),
+  clang::no_builtin("memmove")]]
+void
+move_backwards(unsigned char const* p_source, unsigned char* p_destination,
+               cat::uword bytes) {
+   p_source += bytes.raw;
+   p_destination += bytes.raw;
+
+   move_vector vectors[4];
+   while (bytes >= move_step_bytes) {
+      p_source -= move_step_bytes.raw;
+      p_destination -= move_step_bytes.raw;
+      __builtin_memcpy(&vectors, p_source, sizeof(vectors));
+      __builtin_memcpy(p_destination, &vectors, sizeof(vectors));
+      bytes -= move_step_bytes;
+   }
+
+   while (bytes >= sizeof(cat::uword)) {
+      cat::uword::raw_type word;
+      p_source -= sizeof(word);
+      p_destination -= sizeof(word);
+      __builtin_memcpy(&word, p_source, sizeof(word));
+      __builtin_memcpy(p_destination, &word, sizeof(word));
+      bytes -= sizeof(word);
+   }
+
+   while (bytes > 0u) {
+      --p_source;
+      --p_destination;
+      *p_destination = *p_source;
+      bytes -= 1u;
+   }
+}
+}  // namespace
+
+// Copy some bytes from one address to another address, where both regions
+// may overlap.
+void
+cat::move_memory(void const* p_source, void* p_destination, uword bytes) {
+   unsigned char const* p_source_handle =
+      static_cast<unsigned char const*>(p_source);
+   unsigned char* p_destination_handle =
+      static_cast<unsigned char*>(p_destination);
+
+   // If these regions do not overlap, they can be copied fast.
+   if (p_destination_handle + bytes.raw <= p_source_handle
+       || p_source_handle + bytes.raw <= p_destination_handle) {
+      copy_memory(p_source, p_destination, bytes);
+      return;
+   }
+
+   // Overlapping regions are moved in the direction away from the
+   // destination, so that no source byte is overwritten before it is read.
+   if (p_destination_handle < p_source_handle) {
+      move_forwards(p_source_handle, p_destination_handle, bytes);
+   } else if (p_destination_handle > p_source_handle) {
+      move_backwards(p_source_handle, p_destination_handle, bytes);
+   }
+   zero_upper_avx_registers();
+}
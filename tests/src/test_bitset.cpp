@@ -210,4 +210,43 @@ test(bitset) {
    cat::verify(fullbits.all_of());
    cat::bitset nonebits = cat::make_bitset_filled<8>(false);
    cat::verify(nonebits.none_of());
+
+   // Find runs of 0 bits across storage elements.
+   cat::bitset occupancy = cat::make_bitset_filled<130>(false);
+   cat::verify(occupancy.find_zeros(130u).value() == 0u);
+   occupancy[0] = true;
+   occupancy[30] = true;
+   occupancy[70] = true;
+   cat::verify(occupancy.find_zeros(1u).value() == 1u);
+   cat::verify(occupancy.find_zeros(30u).value() == 31u);
+   cat::verify(occupancy.find_zeros(40u).value() == 71u);
+   cat::verify(!occupancy.find_zeros(60u).has_value());
+}
+
+test(bitset_set_bits) {
+   // This run covers part of the first element, all of the second and third
+   // elements, and part of the fourth.
+   cat::bitset occupancy = cat::make_bitset_filled<260>(false);
+   occupancy.set_bits(5u, 200u, true);
+   cat::verify(occupancy[4] == false);
+   cat::verify(occupancy[5] == true);
+   cat::verify(occupancy[64] == true);
+   cat::verify(occupancy[204] == true);
+   cat::verify(occupancy[205] == false);
+   cat::verify(occupancy.find_zeros(50u).value() == 205u);
+
+   occupancy.set_bits(60u, 10u, false);
+   cat::verify(occupancy[59] == true);
+   cat::verify(occupancy[60] == false);
+   cat::verify(occupancy[69] == false);
+   cat::verify(occupancy[70] == true);
+   cat::verify(occupancy.find_zeros(10u).value() == 60u);
+
+   // Set a run within a single element.
+   cat::bitset small = cat::make_bitset_filled<12>(false);
+   small.set_bits(3u, 6u, true);
+   cat::verify(small[2] == false);
+   cat::verify(small[3] == true);
+   cat::verify(small[8] == true);
+   cat::verify(small[9] == false);
 }
@@ -0,0 +1,114 @@
+#include <cat/caching_page_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+test(caching_page_allocator) {
+   // Initialize an allocator that retains up to 4 pages.
+   cat::is_allocator auto allocator =
+      cat::make_caching_page_allocator(4u * 4_uki);
+
+   // The first allocation must map new pages.
+   cat::span<int4> memory = allocator.xalloc_multi<int4>(1'000u);
+   int4* p_memory = memory.data();
+   memory[999] = 10;
+   cat::verify(allocator.misses() == 1u);
+   cat::verify(allocator.hits() == 0u);
+
+   // Freed pages are retained, and reused by the next allocation.
+   allocator.free(memory);
+   cat::verify(allocator.retained_bytes() == 4_uki);
+   cat::span<int4> reused = allocator.xalloc_multi<int4>(1'000u);
+   cat::verify(reused.data() == p_memory);
+   cat::verify(allocator.hits() == 1u);
+   cat::verify(allocator.retained_bytes() == 0u);
+
+   // A smaller allocation splits a larger cached span, and the excess pages
+   // stay in the cache.
+   allocator.free(reused);
+   cat::span<int4> large = allocator.xalloc_multi<int4>(3u * 1'024u);
+   allocator.free(large);
+   cat::verify(allocator.retained_bytes() == 4u * 4_uki);
+   cat::span<int4> split = allocator.xalloc_multi<int4>(2u * 1'024u);
+   cat::verify(allocator.retained_bytes() == 2u * 4_uki);
+   allocator.free(split);
+
+   // Exceeding the budget trims cached pages back to the kernel.
+   cat::span<int4> huge = allocator.xalloc_multi<int4>(16u * 1'024u);
+   huge[0] = 1;
+   allocator.free(huge);
+   cat::verify(allocator.retained_bytes() <= 4u * 4_uki);
+
+   // Trimmed pages can still be reused.
+   cat::span<int4> retrimmed = allocator.xalloc_multi<int4>(16u * 1'024u);
+   retrimmed[16u * 1'024u - 1u] = 2;
+   cat::verify(retrimmed[16u * 1'024u - 1u] == 2);
+   allocator.free(retrimmed);
+
+   // Growing and shrinking a `vec` repeatedly hits the cache.
+   cat::idx const misses = allocator.misses();
+   for (int4 i = 0; i < 8; ++i) {
+      cat::vec numbers =
+         cat::make_vec_reserved<int4>(allocator, 2'000u).verify();
+      numbers.push_back(i).verify();
+   }
+   cat::verify(allocator.misses() <= misses + 1u);
+
+   allocator.release();
+   cat::verify(allocator.retained_bytes() == 0u);
+};
+
+test(caching_page_allocator_zero_bytes) {
+   cat::caching_page_allocator allocator;
+
+   // An allocation of zero bytes takes a whole page, which is cached and
+   // reused like any other.
+   cat::verify(allocator.nalloc_multi<cat::byte>(0u).value() == 4_uki);
+   void* p_empty = allocator.allocate(0u).verify();
+   allocator.deallocate(p_empty, 0u);
+   cat::verify(allocator.retained_bytes() == 4_uki);
+
+   void* p_reused = allocator.allocate(0u).verify();
+   cat::verify(p_reused == p_empty);
+   cat::verify(allocator.hits() == 1u);
+   allocator.deallocate(p_reused, 0u);
+}
+
+test(caching_page_allocator_coalesce) {
+   cat::caching_page_allocator allocator;
+
+   // Split one cached span of 8 pages into 8 spans of 1 page.
+   cat::span<cat::byte> large = allocator.xalloc_multi<cat::byte>(8u * 4_uki);
+   cat::byte* p_large = large.data();
+   allocator.free(large);
+
+   cat::span<cat::byte> pages[8];
+   for (cat::span<cat::byte>& page : pages) {
+      page = allocator.xalloc_multi<cat::byte>(4_uki);
+   }
+   cat::verify(allocator.misses() == 1u);
+   cat::verify(allocator.hits() == 8u);
+   for (cat::span<cat::byte>& page : pages) {
+      allocator.free(page);
+   }
+   cat::verify(allocator.retained_bytes() == 8u * 4_uki);
+
+   // No single cached page fits this allocation, but they are adjacent, so
+   // they are coalesced back into the original span.
+   cat::span<cat::byte> coalesced =
+      allocator.xalloc_multi<cat::byte>(8u * 4_uki);
+   cat::verify(coalesced.data() == p_large);
+   cat::verify(allocator.misses() == 1u);
+   cat::verify(allocator.retained_bytes() == 0u);
+
+   // Spans which are larger than an allocation are split, and the excess
+   // pages are reused by the next allocation.
+   allocator.free(coalesced);
+   cat::span<cat::byte> front = allocator.xalloc_multi<cat::byte>(3u * 4_uki);
+   cat::span<cat::byte> back = allocator.xalloc_multi<cat::byte>(5u * 4_uki);
+   cat::verify(front.data() == p_large);
+   cat::verify(back.data() == p_large + (3u * 4_uki).raw);
+   cat::verify(allocator.misses() == 1u);
+   allocator.free(front);
+   allocator.free(back);
+}
@@ -0,0 +1,47 @@
+#include <cat/chained_arena_allocator>
+#include <cat/page_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+test(chained_arena_allocator) {
+   cat::page_allocator pager;
+   // Begin with a small block, so that it is exhausted quickly.
+   cat::is_allocator auto arena =
+      cat::make_chained_arena_allocator(pager, 4_uki);
+
+   // Allocations are bumped within the first block.
+   int4* p_first = arena.xalloc<int4>(1);
+   int4* p_second = arena.xalloc<int4>(2);
+   cat::verify(p_second == p_first + 1);
+
+   // Allocations larger than the remaining block chain a new block.
+   cat::span<int4> large = arena.xalloc_multi<int4>(2'000u);
+   large[1'999] = 3;
+   cat::verify(*p_first == 1);
+   cat::verify(*p_second == 2);
+
+   // The most recent allocation can grow in place.
+   cat::span<int4> grown = arena.xalloc_multi<int4>(4u);
+   cat::span<int4> regrown = arena.xrealloc_multi(grown.data(), 4u, 8u);
+   cat::verify(regrown.data() == grown.data());
+
+   // An allocation larger than a doubled block still fits in a new block.
+   cat::span<cat::byte> huge = arena.xalloc_multi<cat::byte>(64_uki);
+   huge[64_uki - 1u] = cat::byte(1u);
+
+   // Resetting keeps the largest block, so the next allocation is made at
+   // the start of that block.
+   arena.reset();
+   int4* p_reused = arena.xalloc<int4>(4);
+   cat::verify(cat::uintptr<void>(p_reused)
+               < cat::uintptr<void>(huge.data()) + 64u);
+   cat::verify(*p_reused == 4);
+
+   // Containers can grow without bound.
+   cat::vec numbers = cat::make_vec<int4>(arena);
+   for (int4 i; i < 10'000; ++i) {
+      numbers.push_back(i).verify();
+   }
+   cat::verify(numbers[9'999] == 9'999);
+}
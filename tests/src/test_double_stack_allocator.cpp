@@ -0,0 +1,61 @@
+#include <cat/double_stack_allocator>
+#include <cat/page_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+test(double_stack_allocator) {
+   // Initialize an allocator.
+   cat::page_allocator pager;
+   cat::span page = pager.alloc_multi<cat::byte>(64u).verify();
+   defer {
+      pager.free(page);
+   };
+   cat::double_stack_allocator allocator =
+      cat::make_double_stack_allocator(page);
+   cat::is_allocator auto& low = allocator.low();
+   cat::is_allocator auto& high = allocator.high();
+
+   // Both ends allocate towards each other.
+   int4* p_low = low.alloc<int4>(1).verify();
+   int4* p_high = high.alloc<int4>(2).verify();
+   cat::verify(static_cast<void*>(p_low) == page.data());
+   cat::verify(static_cast<void*>(p_high + 1) == page.data() + 64);
+   cat::verify(*p_low == 1);
+   cat::verify(*p_high == 2);
+   cat::verify(allocator.remaining_bytes() == 56u);
+   cat::verify(low.owns(p_low) && !low.owns(p_high));
+   cat::verify(high.owns(p_high) && !high.owns(p_low));
+
+   // Neither end can cross the other.
+   cat::verify(!low.alloc_multi<cat::byte>(57u).has_value());
+   cat::verify(!high.alloc_multi<cat::byte>(57u).has_value());
+
+   // Freeing the most recent allocation from an end reclaims it.
+   high.free(p_high);
+   cat::verify(allocator.remaining_bytes() == 60u);
+   cat::verify(high.alloc<int4>().verify() == p_high);
+   low.free(p_low);
+   cat::verify(allocator.remaining_bytes() == 60u);
+
+   // Allocations from the high end are aligned down.
+   allocator.reset();
+   auto _ = high.alloc<cat::byte>().verify();
+   int8* p_aligned = high.alloc<int8>().verify();
+   cat::verify(cat::is_aligned(p_aligned, 8u));
+   cat::verify(static_cast<void*>(p_aligned) == page.data() + 48);
+
+   // The most recent allocation from the low end grows in place.
+   allocator.reset();
+   cat::span<int4> grown = low.xalloc_multi<int4>(2u);
+   int4* p_grown = grown.data();
+   cat::span<int4> regrown = low.xrealloc_multi(p_grown, 2u, 4u);
+   cat::verify(regrown.data() == p_grown);
+
+   // A `vec` can be built from either end.
+   allocator.reset();
+   cat::vec temporaries = cat::make_vec<int4>(low, 1, 2).verify();
+   cat::vec results = cat::make_vec<int4>(high, 3).verify();
+   cat::verify(low.owns(temporaries.data()));
+   cat::verify(high.owns(results.data()));
+}
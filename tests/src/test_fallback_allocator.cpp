@@ -0,0 +1,37 @@
+#include <cat/fallback_allocator>
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+test(fallback_allocator) {
+   cat::page_allocator pager;
+   cat::span arena_page = pager.xalloc_multi<cat::byte>(64u);
+   defer {
+      pager.free(arena_page);
+   };
+   auto arena = cat::make_linear_allocator(arena_page);
+
+   // Allocate from the arena until it is exhausted, and then from pages.
+   cat::is_allocator auto allocator =
+      cat::make_fallback_allocator(arena, pager);
+
+   cat::span<int4> first = allocator.xalloc_multi<int4>(8u);
+   cat::verify(arena.owns(first.data()));
+
+   cat::span<int4> second = allocator.xalloc_multi<int4>(100u);
+   cat::verify(!arena.owns(second.data()));
+   // Pages are known to be zeroed, but the arena's memory is not.
+   cat::verify(allocator.is_allocation_known_zero(second.data(), 400u));
+   cat::verify(!allocator.is_allocation_known_zero(first.data(), 32u));
+   second[99] = 1;
+
+   // The arena still serves allocations which fit in it.
+   int4* p_third = allocator.xalloc<int4>(2);
+   cat::verify(arena.owns(p_third));
+
+   // Memory is freed into the allocator which owns it.
+   allocator.free(second);
+   allocator.free(first);
+   allocator.free(p_third);
+}
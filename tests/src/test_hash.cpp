@@ -0,0 +1,86 @@
+#include <cat/hash>
+#include <cat/string>
+#include <cat/tuple>
+
+#include "../unit_tests.hpp"
+
+namespace {
+constexpr idx buffer_length = 1'000u;
+
+// Fill a buffer with bytes that are not periodic.
+constexpr void
+fill_buffer(char* p_buffer) {
+   for (idx i; i < buffer_length; ++i) {
+      p_buffer[i.raw] = static_cast<char>((i.raw * 131u) ^ (i.raw >> 3u));
+   }
+}
+
+// Hash a buffer during constant evaluation, without the AVX2 stripes.
+constexpr auto
+constant_hash(idx length) -> uword {
+   char buffer[buffer_length.raw];
+   fill_buffer(buffer);
+   return cat::hash_bytes(buffer, length);
+}
+
+struct point {
+   int4 x;
+   int4 y;
+
+   [[nodiscard]]
+   constexpr auto
+   hash() const -> uword {
+      return cat::hash_combine(cat::hash_integer(x), cat::hash_integer(y));
+   }
+};
+}  // namespace
+
+test(hash) {
+   char buffer[buffer_length.raw];
+   fill_buffer(buffer);
+
+   // Hashes evaluated at runtime match constant-evaluated hashes on every
+   // path.
+   constexpr uword short_hash = constant_hash(11u);
+   constexpr uword medium_hash = constant_hash(100u);
+   constexpr uword long_hash = constant_hash(buffer_length);
+   cat::verify(cat::hash_bytes(buffer, 11u) == short_hash);
+   cat::verify(cat::hash_bytes(buffer, 100u) == medium_hash);
+   cat::verify(cat::hash_bytes(buffer, buffer_length) == long_hash);
+
+   // Every length and every flipped byte produces a different hash.
+   for (idx length = 1u; length < 300u; ++length) {
+      uword const original = cat::hash_bytes(buffer, length);
+      cat::verify(original != cat::hash_bytes(buffer, length - 1u));
+      buffer[(length / 2u).raw] ^= 1;
+      cat::verify(original != cat::hash_bytes(buffer, length));
+      buffer[(length / 2u).raw] ^= 1;
+   }
+
+   // The seed changes the hash.
+   cat::verify(cat::hash_bytes(buffer, 64u)
+               != cat::hash_bytes(buffer, 64u, 1u));
+
+   // Strings hash the same as their `str_view`.
+   cat::str_view const string = "Hello, world!";
+   cat::verify(cat::hasher{}(string) == cat::hasher{}("Hello, world!"));
+   cat::verify(cat::hash_bytes(string) == cat::hasher{}(string));
+
+   // Integers hash the same regardless of their width.
+   cat::verify(cat::hasher{}(int4(-1)) == cat::hasher{}(int8(-1)));
+   cat::verify(cat::hash_integer(1u) != cat::hash_integer(2u));
+
+   // Tuples are hashed element-wise, in order.
+   cat::tuple<int4, cat::str_view> const first{1, "one"};
+   cat::tuple<int4, cat::str_view> const second{1, "one"};
+   cat::tuple<int4, int4> const forward{1, 2};
+   cat::tuple<int4, int4> const backward{2, 1};
+   cat::verify(cat::hasher{}(first) == cat::hasher{}(second));
+   cat::verify(cat::hasher{}(forward) != cat::hasher{}(backward));
+
+   // User types can be hashed by a member function.
+   static_assert(cat::is_hashable<point>);
+   static_assert(!cat::is_hashable<cat::monostate_type>);
+   cat::verify(cat::hasher{}(point{1, 2}) == point{1, 2}.hash());
+   cat::verify(cat::hasher{}(point{1, 2}) != cat::hasher{}(point{2, 1}));
+}
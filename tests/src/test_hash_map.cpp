@@ -0,0 +1,76 @@
+#include <cat/hash_map>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+test(hash_map) {
+   cat::page_allocator allocator;
+
+   // Insert enough integers to rehash several times.
+   cat::hash_map map = cat::make_hash_map<int4, int4>(allocator);
+   cat::verify(map.is_empty());
+   for (int4 i = 0; i < 1'000; ++i) {
+      map.insert(i, i * 2).verify();
+   }
+   cat::verify(map.size() == 1'000);
+   cat::verify(map.capacity() >= 1'000);
+   for (int4 i = 0; i < 1'000; ++i) {
+      cat::verify(map.find(i).verify() == i * 2);
+   }
+   cat::verify(!map.contains(1'000));
+
+   // Inserting an existing key assigns its value.
+   map.insert(5, -5).verify();
+   cat::verify(map.size() == 1'000);
+   cat::verify(map.find(5).verify() == -5);
+
+   // Erase every even key. Odd keys must still be found past the deleted
+   // slots.
+   for (int4 i = 0; i < 1'000; i += 2) {
+      cat::verify(map.erase(i));
+   }
+   cat::verify(!map.erase(0));
+   cat::verify(map.size() == 500);
+   for (int4 i = 1; i < 1'000; i += 2) {
+      cat::verify(map.contains(i));
+   }
+   cat::verify(!map.contains(2));
+
+   // Rehashing keeps every entry.
+   map.rehash(4'096).verify();
+   cat::verify(map.capacity() == 4'096);
+   cat::verify(map.find(999).verify() == 1'998);
+
+   idx visited = 0u;
+   map.for_each([&](int4 const&, int4&) {
+      ++visited;
+   });
+   cat::verify(visited == 500u);
+
+   map.clear();
+   cat::verify(map.is_empty());
+   cat::verify(!map.contains(1));
+}
+
+test(hash_map_strings) {
+   cat::page_allocator allocator;
+   cat::hash_map map = cat::make_hash_map<cat::str_view, int4>(allocator);
+   map.reserve(64).verify();
+   idx const capacity = map.capacity();
+
+   map.insert("one", 1).verify();
+   map.insert("two", 2).verify();
+   map.insert("three", 3).verify();
+   cat::verify(map.capacity() == capacity);
+
+   // Look up a `str_view` key with other string types.
+   char const* p_two = "two";
+   cat::verify(map.find(p_two).verify() == 2);
+   cat::verify(map.find(cat::str_view("three")).verify() == 3);
+   cat::verify(!map.contains("four"));
+
+   // String literals are looked up by decaying them to `char const*`.
+   cat::verify(map.find("one").verify() == 1);
+   cat::verify(map.erase("one"));
+   cat::verify(!map.contains("one"));
+}
@@ -90,6 +90,47 @@ overallocated:
    // reserved to allocate a 4-byte aligned value:
    cat::verify(allocator.nalloc<int4>().or_exit() == 6u);
 
+   // Test resizing the most recent allocation in place.
+   allocator.reset();
+   cat::span<int4> grown = allocator.xalloc_multi<int4>(2u);
+   grown[0] = 1;
+   grown[1] = 2;
+   int4* p_grown = grown.data();
+   cat::span<int4> regrown = allocator.xrealloc_multi(p_grown, 2u, 4u);
+   cat::verify(regrown.data() == p_grown);
+   cat::verify(regrown.size() == 4);
+   cat::verify(regrown[1] == 2);
+
+   // An allocation that is not the most recent one must move, even to shrink.
+   auto _ = allocator.alloc<int4>().verify();
+   cat::span<int4> moved = allocator.xrealloc_multi(p_grown, 4u, 1u);
+   cat::verify(moved.data() != p_grown);
+
+   // Rewinding to a checkpoint reuses the memory allocated after it.
+   allocator.reset();
+   auto _ = allocator.alloc<int4>().verify();
+   cat::linear_allocator::checkpoint_marker marker = allocator.checkpoint();
+   int4* p_temporary = allocator.xalloc<int4>();
+   allocator.rewind(marker);
+   cat::verify(allocator.xalloc<int4>() == p_temporary);
+
+   // Nested scopes rewind when they end.
+   allocator.reset();
+   int4* p_outer;
+   {
+      auto outer_scope = allocator.make_scope();
+      p_outer = allocator.xalloc<int4>();
+      {
+         auto inner_scope = allocator.make_scope();
+         auto _ = allocator.xalloc<int4>();
+         auto _ = allocator.xalloc<int4>();
+      }
+      // The inner scope's memory is available again.
+      cat::verify(allocator.nalloc<int4>().verify() == 4u);
+      cat::verify(allocator.xalloc<int4>() == p_outer + 1);
+   }
+   cat::verify(allocator.xalloc<int4>() == p_outer);
+
    // TODO: Test multi allocations.
    // TODO: Test inline multi allocations.
 }
@@ -2,13 +2,14 @@
 #include <cat/linear_allocator>
 #include <cat/list>
 #include <cat/page_allocator>
+#include <cat/stats_allocator>
 
 #include "../unit_tests.hpp"
 
 test(list) {
    // Initialize an allocator.
    cat::page_allocator pager;
-   cat::span page = pager.alloc_multi<cat::byte>(4_uki).or_exit();
+   cat::span page = pager.alloc_multi<cat::byte>(8_uki).or_exit();
    defer {
       pager.free(page);
    };
@@ -158,6 +159,36 @@ test(list) {
    cat::verify(!null_list.emplace_back(1).has_value());
    cat::verify(!null_list.emplace_front(1).has_value());
 
+   // Removed nodes are reused before another batch is allocated.
+   auto stats = cat::make_stats_allocator(allocator);
+   cat::list pooled = cat::make_list<int4>(stats).verify();
+   int4* p_first = &*pooled.push_back(1).verify();
+   pooled.pop_back();
+   cat::verify(&*pooled.push_back(2).verify() == p_first);
+   for (int4 i = 0; i < 3; ++i) {
+      auto _ = pooled.push_back(i).verify();
+   }
+   cat::verify(stats.stats().allocations == 1u);
+
+   // Cleared nodes are reused too.
+   pooled.clear();
+   cat::verify(pooled.size() == 0);
+   for (int4 i = 0; i < 4; ++i) {
+      auto _ = pooled.push_front(i).verify();
+   }
+   cat::verify(pooled.front() == 3);
+   cat::verify(stats.stats().allocations == 1u);
+
+   // Reserving nodes allocates them in one batch.
+   pooled.reserve(20u).verify();
+   cat::verify(stats.stats().allocations == 2u);
+   for (int4 i = 0; i < 16; ++i) {
+      auto _ = pooled.push_back(i).verify();
+   }
+   cat::verify(pooled.size() == 20);
+   cat::verify(pooled.back() == 15);
+   cat::verify(stats.stats().allocations == 2u);
+
    // Test `slist`.
    cat::slist slist_1 = cat::make_slist<int4>(allocator).verify();
    cat::verify(slist_1.size() == 0);
@@ -210,6 +241,81 @@ test(list) {
    // cat::verify(*(slist_2.begin() + 2) == 2);
    // cat::verify(*(slist_2.begin() + 3) == 3);
 
+   // Splicing a whole `list` moves its nodes.
+   cat::list splice_1 = cat::make_list<int4>(allocator, 1, 4).verify();
+   cat::list splice_2 = cat::make_list<int4>(allocator, 2, 3).verify();
+   int4* p_two = &splice_2.front();
+   splice_1.splice(++splice_1.begin(), splice_2);
+   cat::verify(splice_1.size() == 4);
+   cat::verify(splice_2.size() == 0);
+   cat::verify(&*++splice_1.begin() == p_two);
+   int4 expected = 1;
+   for (int4& value : splice_1) {
+      cat::verify(value == expected);
+      ++expected;
+   }
+
+   // Elements and ranges are moved within a `list`.
+   splice_1.splice(splice_1.begin(), splice_1.begin() + 3u);
+   cat::verify(splice_1.front() == 4);
+   cat::verify(splice_1.back() == 3);
+   splice_1.splice_range(splice_1.end(), splice_1.begin(),
+                         splice_1.begin() + 2u);
+   cat::verify(splice_1.front() == 2);
+   cat::verify(*(splice_1.begin() + 1u) == 3);
+   cat::verify(*(splice_1.begin() + 2u) == 4);
+   cat::verify(splice_1.back() == 1);
+   cat::verify(*splice_1.rbegin() == 1);
+
+   // Sorting relinks nodes without moving elements.
+   int4* p_one = &splice_1.back();
+   splice_1.sort();
+   cat::verify(&splice_1.front() == p_one);
+   expected = 1;
+   for (int4& value : splice_1) {
+      cat::verify(value == expected);
+      ++expected;
+   }
+   cat::verify(splice_1.back() == 4);
+
+   splice_1.sort([](int4 left, int4 right) -> bool {
+      return left > right;
+   });
+   cat::verify(splice_1.front() == 4);
+   cat::verify(splice_1.back() == 1);
+
+   // Merging two sorted lists.
+   cat::list merge_1 = cat::make_list<int4>(allocator, 1, 3, 5, 7).verify();
+   cat::list merge_2 = cat::make_list<int4>(allocator, 2, 3, 6).verify();
+   int4* p_first_three = &*(merge_1.begin() + 1u);
+   merge_1.merge(merge_2);
+   cat::verify(merge_1.size() == 7);
+   cat::verify(merge_2.size() == 0);
+   cat::verify(&*(merge_1.begin() + 2u) == p_first_three);
+   int4 previous = 0;
+   for (int4& value : merge_1) {
+      cat::verify(value >= previous);
+      previous = value;
+   }
+   cat::verify(merge_1.back() == 7);
+
+   // An `slist` is spliced, sorted and merged the same way.
+   cat::slist sorted_slist = cat::make_slist<int4>(allocator, 5, 1, 4).verify();
+   cat::slist other_slist = cat::make_slist<int4>(allocator, 3, 2).verify();
+   sorted_slist.splice(sorted_slist.end(), other_slist);
+   cat::verify(sorted_slist.size() == 5);
+   sorted_slist.sort();
+   expected = 1;
+   for (int4& value : sorted_slist) {
+      cat::verify(value == expected);
+      ++expected;
+   }
+   cat::verify(expected == 6);
+   cat::slist merge_slist = cat::make_slist<int4>(allocator, 0, 6).verify();
+   sorted_slist.merge(merge_slist);
+   cat::verify(sorted_slist.size() == 7);
+   cat::verify(sorted_slist.front() == 0);
+
    // Test `back_insert_iterator`.
    cat::list back_list = cat::make_list<int4>(allocator).verify();
    cat::back_insert_iterator back_iterator(back_list);
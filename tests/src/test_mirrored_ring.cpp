@@ -0,0 +1,60 @@
+#include <cat/mirrored_ring>
+
+#include "../unit_tests.hpp"
+
+test(mirrored_ring) {
+   // The capacity is rounded up to a page.
+   cat::mirrored_ring ring = cat::make_mirrored_ring(3'000u).verify();
+   cat::verify(ring.capacity() == cat::mirrored_ring::page_bytes);
+   cat::verify(ring.is_empty());
+   cat::verify(ring.writable().size() == cat::mirrored_ring::page_bytes);
+
+   // Move the head near the end of the storage, so that the next write
+   // crosses the mirror 96 bytes in.
+   cat::verify(ring.capacity() == 4'096u);
+   ring.commit(4'000u);
+   ring.consume(4'000u);
+   cat::verify(ring.is_empty());
+   cat::verify(ring.writable().size() == 4'096u);
+
+   // Write across the end of the storage through one contiguous span.
+   cat::span<cat::byte> writable = ring.writable();
+   cat::verify(writable.size() == cat::mirrored_ring::page_bytes);
+   for (idx i; i < 1'000u; ++i) {
+      writable[i].value = static_cast<uint1::raw_type>(i.raw);
+   }
+   ring.commit(1'000u);
+
+   // The written bytes are read back through one contiguous span.
+   cat::span<cat::byte> readable = ring.readable();
+   cat::verify(readable.size() == 1'000u);
+   cat::verify(readable.data() == writable.data());
+   for (idx i; i < 1'000u; ++i) {
+      cat::verify(readable[i].value == static_cast<uint1::raw_type>(i.raw));
+   }
+
+   // Bytes past the end of the storage alias its beginning, so consuming
+   // past the end wraps the head around.
+   ring.consume(500u);
+   cat::verify(ring.readable().data()
+               == readable.data() + 500u - ring.capacity().raw);
+   cat::verify(ring.readable()[0].value
+               == static_cast<uint1::raw_type>(500u));
+   // The bytes written past the end of the storage landed at its
+   // beginning, and writes there show up past the end again.
+   cat::byte* p_storage = ring.readable().data() - 404u;
+   cat::verify(p_storage[0].value == static_cast<uint1::raw_type>(96u));
+   p_storage[1].value = 7u;
+   cat::verify(readable[97].value == 7u);
+   ring.consume(500u);
+   cat::verify(ring.is_empty());
+
+   // A full ring has no writable bytes.
+   ring.commit(ring.capacity());
+   cat::verify(ring.is_full());
+   cat::verify(ring.writable().size() == 0u);
+
+   // Rings can be moved.
+   cat::mirrored_ring moved = cat::move(ring);
+   cat::verify(moved.size() == cat::mirrored_ring::page_bytes);
+}
@@ -0,0 +1,88 @@
+#include <cat/atomic>
+#include <cat/mpmc_queue>
+#include <cat/page_allocator>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+using queue_type = cat::mpmc_queue<idx, cat::page_allocator>;
+
+constexpr idx messages_per_producer = 10'000u;
+constexpr idx thread_count = 2u;
+
+// Threads cannot take arguments yet, so they share these globals.
+constinit queue_type* p_shared_queue = nullptr;
+constinit cat::atomic<uword::raw_type> consumed_sum = 0u;
+constinit cat::atomic<uword::raw_type> consumed_count = 0u;
+
+// Push the numbers from 1 to `messages_per_producer`, waiting while the
+// queue is full.
+[[gnu::no_sanitize_address]]
+void
+produce() {
+   for (idx i = 1u; i <= messages_per_producer; ++i) {
+      p_shared_queue->push(i);
+   }
+}
+
+// Pop messages until every producer's messages have been consumed.
+[[gnu::no_sanitize_address]]
+void
+consume() {
+   constexpr uword::raw_type total = (messages_per_producer * thread_count).raw;
+   while (consumed_count.load() < total) {
+      cat::maybe message = p_shared_queue->try_pop();
+      if (message.has_value()) {
+         consumed_sum += message.value().raw;
+         ++consumed_count;
+      } else {
+         cat::relax_cpu();
+      }
+   }
+}
+
+}  // namespace
+
+test(mpmc_queue) {
+   cat::page_allocator allocator;
+   queue_type queue = cat::make_mpmc_queue<idx>(allocator, 4u).verify();
+   cat::verify(queue.capacity() == 4u);
+
+   // A full queue rejects pushes, and an empty queue rejects pops.
+   cat::verify(!queue.try_pop().has_value());
+   for (idx i; i < 4u; ++i) {
+      queue.try_push(i).verify();
+   }
+   cat::verify(!queue.try_push(4u).has_value());
+
+   // Elements are popped in order, across laps of the ring.
+   cat::verify(queue.try_pop().verify() == 0u);
+   queue.push(4u);
+   for (idx i = 1u; i < 5u; ++i) {
+      cat::verify(queue.pop() == i);
+   }
+   cat::verify(!queue.try_pop().has_value());
+
+   // Share a queue between several producers and consumers.
+   queue_type shared_queue = cat::make_mpmc_queue<idx>(allocator, 64u).verify();
+   p_shared_queue = &shared_queue;
+   cat::thread producers[thread_count.raw];
+   cat::thread consumers[thread_count.raw];
+   for (idx i; i < thread_count; ++i) {
+      producers[i.raw].spawn(allocator, 64_uki, 4_uki, &produce).verify();
+      consumers[i.raw].spawn(allocator, 64_uki, 4_uki, &consume).verify();
+   }
+   for (idx i; i < thread_count; ++i) {
+      producers[i.raw].join().verify();
+      consumers[i.raw].join().verify();
+   }
+
+   // Every message was consumed exactly once.
+   uword::raw_type const sum_per_producer =
+      (messages_per_producer * (messages_per_producer + 1u) / 2u).raw;
+   cat::verify(consumed_count.load() == (messages_per_producer * 2u).raw);
+   cat::verify(consumed_sum.load() == sum_per_producer * thread_count.raw);
+   cat::verify(!shared_queue.try_pop().has_value());
+}
@@ -93,4 +93,65 @@ test(paging_memory) {
    aligned_mem[0] = 10;
    cat::verify(aligned_mem[0] == 10);
    allocator.free(aligned_mem);
+
+   // Shrinking pages happens in place.
+   cat::span<int4> shrinking = allocator.xalloc_multi<int4>(4'000u);
+   int4* p_shrinking = shrinking.data();
+   cat::span<int4> shrunk = allocator.xrealloc_multi(p_shrinking, 4'000u, 10u);
+   cat::verify(shrunk.data() == p_shrinking);
+   allocator.free(shrunk);
+};
+
+test(paging_memory_huge_pages) {
+   // Transparent huge pages are aligned to a whole huge page.
+   cat::basic_page_allocator<cat::huge_page_policy::transparent> transparent;
+   cat::verify(transparent.page_bytes == 2_umi);
+   cat::span<int4> memory = transparent.xalloc_multi<int4>(1_umi);
+   cat::verify(cat::is_aligned(memory.data(), 2_umi));
+   memory[0] = 1;
+   memory[1_umi - 1u] = 2;
+   cat::verify(memory[1_umi - 1u] == 2);
+   transparent.free(memory);
+
+   // Explicit huge pages fall back to transparent huge pages when the kernel
+   // has none reserved, so this succeeds either way.
+   auto explicit_pages =
+      cat::make_page_allocator<cat::huge_page_policy::explicit_2mb>();
+   cat::span<int4> numbers = explicit_pages.xalloc_multi<int4>(1'000u);
+   cat::verify(cat::is_aligned(numbers.data(), 2_umi));
+   numbers[999] = 10;
+   cat::verify(numbers[999] == 10);
+   explicit_pages.free(numbers);
+};
+
+test(paging_memory_commit_policies) {
+   // Lazily committed pages are only faulted in when they are touched, so
+   // this large allocation is cheap. `.alloc_multi()` would construct every
+   // element, so raw memory is allocated here instead.
+   auto lazy = cat::make_page_allocator<cat::huge_page_policy::none,
+                                        cat::page_commit_policy::lazy>();
+   int4* p_lazy = static_cast<int4*>(lazy.allocate(256_umi).verify());
+   p_lazy[64_umi - 1u] = 1;
+   cat::verify(p_lazy[64_umi - 1u] == 1);
+   lazy.deallocate(p_lazy, 256_umi);
+
+   // Reserved pages grow in place by committing more of their reservation.
+   auto reserving =
+      cat::make_page_allocator<cat::huge_page_policy::none,
+                               cat::page_commit_policy::reserve>();
+   cat::span<int4> reserved = reserving.xalloc_multi<int4>(1'024u);
+   int4* p_reserved = reserved.data();
+   reserved[1'023] = 1;
+   cat::span<int4> grown =
+      reserving.xrealloc_multi(p_reserved, 1'024u, 1'024u * 1'024u);
+   cat::verify(grown.data() == p_reserved);
+   cat::verify(grown[1'023] == 1);
+   grown[1'024u * 1'024u - 1u] = 2;
+
+   // Shrinking decommits the tail of the reservation.
+   cat::span<int4> shrunk =
+      reserving.xrealloc_multi(p_reserved, 1'024u * 1'024u, 2'048u);
+   cat::verify(shrunk.data() == p_reserved);
+   cat::verify(shrunk[1'023] == 1);
+   reserving.free(shrunk);
 };
@@ -0,0 +1,57 @@
+#include <cat/linux>
+#include <cat/persistent_arena_allocator>
+
+#include "../unit_tests.hpp"
+
+namespace {
+struct persistent_node {
+   int4 value;
+   persistent_node* p_next;
+};
+}  // namespace
+
+test(persistent_arena_allocator) {
+   char const* p_path = "/tmp/cat_persistent_arena";
+   auto _ = nix::sys_unlink(p_path);
+   defer {
+      auto _ = nix::sys_unlink(p_path);
+   };
+
+   // Build a small list in a new arena, and store its head as the root.
+   {
+      cat::persistent_arena_allocator arena =
+         cat::make_persistent_arena_allocator(p_path, 16_uki).verify();
+      cat::verify(arena.root<persistent_node>() == nullptr);
+      cat::verify(arena.used_bytes()
+                  == cat::persistent_arena_allocator::data_offset);
+
+      persistent_node* p_head = nullptr;
+      for (int4 i = 0; i < 8; ++i) {
+         persistent_node* p_node =
+            arena.alloc<persistent_node>(i, p_head).verify();
+         p_head = p_node;
+      }
+      arena.set_root(p_head);
+      arena.sync().verify();
+
+      // This arena cannot hold more than 16 kibibytes.
+      cat::verify(!arena.alloc_multi<cat::byte>(16_uki).has_value());
+   }
+
+   // Reopen the arena, and walk the list from its root.
+   {
+      cat::persistent_arena_allocator arena =
+         cat::make_persistent_arena_allocator(p_path, 16_uki).verify();
+      persistent_node* p_node = arena.root<persistent_node>();
+      for (int4 i = 7; i >= 0; --i) {
+         cat::verify(p_node != nullptr);
+         cat::verify(p_node->value == i);
+         p_node = p_node->p_next;
+      }
+      cat::verify(p_node == nullptr);
+
+      // Resetting the arena clears its root.
+      arena.reset();
+      cat::verify(arena.root<persistent_node>() == nullptr);
+   }
+}
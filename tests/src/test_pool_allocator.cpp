@@ -1,4 +1,6 @@
+#include <cat/concurrent_pool_allocator>
 #include <cat/pool_allocator>
+#include <cat/thread>
 
 #include "../unit_tests.hpp"
 
@@ -47,3 +49,87 @@ test(pool_allocator) {
    int4* p_int4 = allocator.alloc<int4>(40).verify();
    cat::verify(*p_int4 == 40);
 }
+
+test(pool_allocator_lazy_free_list) {
+   // Initialize an allocator over lazily committed pages.
+   auto pager = cat::make_page_allocator<cat::huge_page_policy::none,
+                                         cat::page_commit_policy::lazy>();
+   cat::byte* p_page =
+      static_cast<cat::byte*>(pager.allocate(64_umi).verify());
+   defer {
+      pager.deallocate(p_page, 64_umi);
+   };
+   cat::span page = cat::span(p_page, 64_umi);
+   cat::is_allocator auto allocator = cat::make_pool_allocator<8>(page);
+
+   // Unused nodes are handed out in order.
+   int8* p_int1 = allocator.xalloc<int8>(1);
+   int8* p_int2 = allocator.xalloc<int8>(2);
+   cat::verify(p_int2 == p_int1 + 1);
+
+   // Freed nodes are reused before any unused nodes.
+   allocator.free(p_int1);
+   int8* p_int3 = allocator.xalloc<int8>(3);
+   cat::verify(p_int3 == p_int1);
+
+   // Resetting hands out nodes from the beginning of the pool again.
+   allocator.reset();
+   int8* p_int4 = allocator.xalloc<int8>(4);
+   cat::verify(p_int4 == p_int1);
+}
+
+namespace {
+using concurrent_pool = cat::concurrent_pool_allocator<8>;
+
+// Threads cannot take arguments yet, so they share these globals.
+constinit concurrent_pool* p_shared_pool = nullptr;
+constinit cat::atomic<int> next_thread_id = 0;
+
+// `cat::thread` spawns threads with a raw `clone` syscall rather than through
+// `pthread_create()`, so their stacks are never registered with ASan's
+// runtime. ASan has no thread state for them, and `%fs` points to a
+// `thread_control_block` rather than to ASan's thread-local data, so
+// instrumented code in this function faults when it looks up its thread.
+[[gnu::no_sanitize_address]]
+void
+churn_concurrent_pool() {
+   int8 const thread_id = next_thread_id++;
+   int8* allocations[16];
+   for (idx i; i < 1'000u; ++i) {
+      for (int8*& p_allocation : allocations) {
+         p_allocation = p_shared_pool->xalloc<int8>(thread_id);
+      }
+      // No other thread may have been handed the same nodes.
+      for (int8* p_allocation : allocations) {
+         cat::verify(*p_allocation == thread_id);
+         p_shared_pool->free(p_allocation);
+      }
+   }
+}
+}  // namespace
+
+test(concurrent_pool_allocator) {
+   // Initialize an allocator with exactly enough nodes for every thread.
+   cat::page_allocator pager;
+   cat::span page = pager.alloc_multi<cat::byte>(8u * 16u * 4u).verify();
+   defer {
+      pager.free(page);
+   };
+   concurrent_pool allocator = cat::make_concurrent_pool_allocator<8>(page);
+   p_shared_pool = &allocator;
+
+   cat::thread threads[3];
+   for (cat::thread& thread : threads) {
+      thread.spawn(pager, 16_uki, 2_uki, &churn_concurrent_pool).verify();
+   }
+   churn_concurrent_pool();
+   for (cat::thread& thread : threads) {
+      thread.join().verify();
+   }
+
+   // Every node is now free, so they can all be allocated again.
+   for (idx i; i < 16u * 4u; ++i) {
+      auto* _ = allocator.alloc<int8>().verify();
+   }
+   cat::verify(!allocator.alloc<int8>().has_value());
+}
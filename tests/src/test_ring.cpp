@@ -7,12 +7,11 @@
 test(ring) {
    // Initialize an allocator.
    cat::page_allocator pager;
-   pager.reset();
-   auto page = pager.opq_alloc_multi<cat::byte>(4_ki - 32).or_exit();
+   cat::span page = pager.alloc_multi<cat::byte>(4_uki).verify();
    defer {
       pager.free(page);
    };
-   auto allocator = cat::linear_allocator::backed_handle(pager, page);
+   auto allocator = cat::make_linear_allocator(page);
 
    cat::ring<int4> ring_int4;
    cat::verify(ring_int4.size() == 0);
@@ -33,6 +32,7 @@ test(ring) {
    // Wrapping `.push_back()`.
    ring_int4.push_back(20);
    cat::verify(ring_int4[0] == 20);
+   cat::verify(ring_int4.size() == 4);
 
    // Set element.
    ring_int4[1] = 10;
@@ -40,4 +40,38 @@ test(ring) {
 
    ring_int4.at(1).value() = 5;
    cat::verify(ring_int4[1] == 5);
+
+   // Growing a full ring moves its oldest element to the front.
+   ring_int4.reserve(allocator, 8).verify();
+   cat::verify(ring_int4.capacity() == 8);
+   cat::verify(ring_int4[0] == 5);
+   cat::verify(ring_int4[1] == 2);
+   cat::verify(ring_int4[2] == 0);
+   cat::verify(ring_int4[3] == 20);
+   ring_int4.push_back(30);
+   cat::verify(ring_int4[4] == 30);
+
+   // Clone a ring.
+   cat::ring<int4> cloned = ring_int4.clone(allocator).verify();
+   cat::verify(cloned.size() == ring_int4.size());
+   cat::verify(cloned.data() != ring_int4.data());
+   for (iword i = 0; i < cloned.size(); ++i) {
+      cat::verify(cloned[i] == ring_int4[i]);
+   }
+
+   // Make rings with the static factories.
+   cat::ring<int4> reserved = cat::ring<int4>::reserved(allocator, 16).verify();
+   cat::verify(reserved.size() == 0);
+   cat::verify(reserved.capacity() == 16);
+
+   cat::ring<int4> filled = cat::ring<int4>::filled(allocator, 4, 7).verify();
+   cat::verify(filled.size() == 4);
+   for (iword i = 0; i < filled.size(); ++i) {
+      cat::verify(filled[i] == 7);
+   }
+   filled.push_back(8);
+   cat::verify(filled[0] == 8);
+
+   filled.free(allocator);
+   cat::verify(filled.capacity() == 0);
 }
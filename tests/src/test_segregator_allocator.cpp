@@ -0,0 +1,70 @@
+#include <cat/page_allocator>
+#include <cat/pool_allocator>
+#include <cat/segregator_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+// A threshold larger than a pool's nodes is rejected.
+static_assert(requires {
+   typename cat::segregator_allocator<64u, cat::pool_allocator<64u>,
+                                      cat::page_allocator>;
+});
+static_assert(!requires {
+   typename cat::segregator_allocator<128u, cat::pool_allocator<64u>,
+                                      cat::page_allocator>;
+});
+
+test(segregator_allocator) {
+   cat::page_allocator pager;
+   cat::span pool_page = pager.xalloc_multi<cat::byte>(4_uki);
+   defer {
+      pager.free(pool_page);
+   };
+   auto pool = cat::make_pool_allocator<64u>(pool_page);
+
+   // Route allocations of up to 64 bytes to the pool, and larger
+   // allocations to pages.
+   cat::is_allocator auto allocator =
+      cat::make_segregator_allocator<64u>(pool, pager);
+
+   int4* p_small = allocator.xalloc<int4>(1);
+   cat::verify(pool.owns(p_small));
+   cat::verify(*p_small == 1);
+
+   cat::span<int4> large = allocator.xalloc_multi<int4>(1'000u);
+   cat::verify(!pool.owns(large.data()));
+   large[999] = 2;
+
+   // Memory is freed into the allocator that it was routed to.
+   allocator.free(p_small);
+   cat::verify(allocator.xalloc<int4>(3) == p_small);
+   allocator.free(large);
+
+   // A `vec` moves from the pool to pages as it grows.
+   cat::vec numbers = cat::make_vec<int4>(allocator);
+   for (int4 i; i < 100; ++i) {
+      numbers.push_back(i).verify();
+   }
+   cat::verify(!pool.owns(numbers.data()));
+   cat::verify(numbers[99] == 99);
+
+   // A `vec` which grew onto pages and then shrank below the threshold is
+   // still freed into pages, so the pool is not handed a page.
+   {
+      cat::vec shrunk = cat::make_vec<int4>(allocator);
+      for (int4 i; i < 100; ++i) {
+         shrunk.push_back(i).verify();
+      }
+      shrunk.erase(2, 100);
+      cat::verify(shrunk.size() == 2);
+   }
+   for (idx i; i < 4u; ++i) {
+      cat::verify(pool.owns(allocator.xalloc<int4>(4)));
+   }
+
+   // Single bytes are routed through `.allocate()`.
+   cat::span<cat::byte> bytes = allocator.xalloc_multi<cat::byte>(3u);
+   cat::verify(pool.owns(bytes.data()));
+   allocator.free(bytes);
+}
@@ -49,3 +49,36 @@ test(set_memory) {
    cat::zero_memory_scalar(p_page, 4_uki);
    cat::verify(p_page[1'001] == 0_u1);
 };
+
+test(move_memory) {
+   using namespace cat::arithmetic_literals;
+
+   cat::page_allocator allocator;
+   cat::span page = allocator.alloc_multi<uint1>(4_uki).or_exit();
+   defer {
+      allocator.free(page);
+   };
+   uint1* p_page = page.data();
+
+   // Move down by a few bytes, so that the regions overlap. This covers
+   // whole vector blocks, whole words, and single bytes.
+   for (idx i; i < 1'000u; ++i) {
+      p_page[i.raw] = static_cast<uint1::raw_type>(i.raw % 251u);
+   }
+   cat::move_memory(p_page + 3, p_page, 997u);
+   for (idx i; i < 997u; ++i) {
+      cat::verify(p_page[i.raw]
+                  == static_cast<uint1::raw_type>((i.raw + 3u) % 251u));
+   }
+
+   // Move up by a few bytes.
+   for (idx i; i < 1'000u; ++i) {
+      p_page[i.raw] = static_cast<uint1::raw_type>(i.raw % 251u);
+   }
+   cat::move_memory(p_page, p_page + 5, 995u);
+   for (idx i; i < 995u; ++i) {
+      cat::verify(p_page[i.raw + 5u]
+                  == static_cast<uint1::raw_type>(i.raw % 251u));
+   }
+   cat::verify(p_page[4] == 4_u1);
+}
@@ -0,0 +1,186 @@
+#include <cat/atomic>
+#include <cat/format>
+#include <cat/list>
+#include <cat/size_class_allocator>
+#include <cat/string>
+#include <cat/thread>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+namespace {
+constexpr idx thread_count = 3u;
+constexpr idx handed_off_count = 64u;
+
+// Threads cannot take arguments yet, so they share these globals.
+constinit cat::size_class_allocator* p_shared_allocator = nullptr;
+constinit cat::atomic<int> next_thread_id = 0;
+constinit int8* handed_off[thread_count.raw][handed_off_count.raw] = {};
+
+// `cat::thread` spawns threads with a raw `clone` syscall, so ASan has no
+// thread state for them. See `churn_concurrent_pool()`.
+[[gnu::no_sanitize_address]]
+void
+churn_size_classes() {
+   int8 const thread_id = next_thread_id++;
+   int8* allocations[16];
+   for (idx i; i < 1'000u; ++i) {
+      for (int8*& p_allocation : allocations) {
+         p_allocation = p_shared_allocator->xalloc<int8>(thread_id);
+      }
+      // No other thread may have been handed the same blocks.
+      for (int8* p_allocation : allocations) {
+         cat::verify(*p_allocation == thread_id);
+         p_shared_allocator->free(p_allocation);
+      }
+   }
+
+   // Hand some blocks off to be freed by another thread.
+   for (int8*& p_allocation : handed_off[thread_id.raw]) {
+      p_allocation = p_shared_allocator->xalloc<int8>(thread_id);
+   }
+}
+
+// Free the blocks which another thread allocated, into this thread's cache.
+[[gnu::no_sanitize_address]]
+void
+free_handed_off() {
+   int8 const thread_id = next_thread_id++;
+   // Each of the `thread_count` threads frees the next thread's blocks.
+   int8 const owner_id = (thread_id + 1) % 3;
+   for (int8* p_allocation : handed_off[owner_id.raw]) {
+      cat::verify(*p_allocation == owner_id);
+      p_shared_allocator->free(p_allocation);
+   }
+   // Those blocks are then reused by this thread.
+   for (idx i; i < handed_off_count; ++i) {
+      p_shared_allocator->free(p_shared_allocator->xalloc<int8>(thread_id));
+   }
+   p_shared_allocator->flush_thread_cache();
+}
+}  // namespace
+
+test(size_class_allocator) {
+   // Initialize an allocator.
+   cat::is_allocator auto allocator = cat::make_size_class_allocator();
+
+   // Size classes are contiguous and round up by at most 25%.
+   cat::verify(cat::size_class_allocator::size_class_of(1u) == 0u);
+   cat::verify(cat::size_class_allocator::size_class_of(16u) == 0u);
+   cat::verify(cat::size_class_allocator::size_class_of(17u) == 1u);
+   cat::verify(cat::size_class_allocator::size_class_bytes(
+                  cat::size_class_allocator::size_class_of(129u))
+               == 160u);
+   for (idx bytes = 1u; bytes <= cat::size_class_allocator::max_small_bytes;
+        ++bytes) {
+      idx const class_bytes = cat::size_class_allocator::size_class_bytes(
+         cat::size_class_allocator::size_class_of(bytes));
+      cat::verify(class_bytes >= bytes);
+      cat::verify(bytes <= 128u || class_bytes * 4u <= bytes * 5u);
+   }
+
+   // Freed blocks are reused by the next allocation of their size class.
+   int4* p_int = allocator.xalloc<int4>(1);
+   allocator.free(p_int);
+   int4* p_reused = allocator.xalloc<int4>(2);
+   cat::verify(p_reused == p_int);
+   cat::verify(*p_reused == 2);
+   allocator.free(p_reused);
+
+   // Over-aligned allocations are aligned.
+   cat::span aligned = allocator.align_xalloc_multi<int4>(64u, 5u);
+   cat::verify(cat::is_aligned(aligned.data(), 64u));
+   allocator.free(aligned);
+
+   // Large allocations bypass the size classes.
+   cat::span<int4> large = allocator.xalloc_multi<int4>(100'000u);
+   large[99'999] = 1;
+   cat::verify(large[99'999] == 1);
+   allocator.free(large);
+
+   // Reallocating within a size class happens in place.
+   cat::span<int4> resized = allocator.xalloc_multi<int4>(33u);
+   int4* p_resized = resized.data();
+   resized = allocator.xrealloc_multi(p_resized, 33u, 40u);
+   cat::verify(resized.data() == p_resized);
+   allocator.free(resized);
+
+   // `vec` can use this allocator.
+   cat::vec numbers = cat::make_vec<int4>(allocator);
+   for (int4 i = 0; i < 10'000; ++i) {
+      numbers.push_back(i).verify();
+   }
+   cat::verify(numbers[9'999] == 9'999);
+
+   // `list` can use this allocator.
+   cat::list list = cat::make_list<int4>(allocator).verify();
+   for (int4 i = 0; i < 1'000; ++i) {
+      auto _ = list.push_back(i).verify();
+   }
+   cat::verify(list.back() == 999);
+
+   // `fmt` can use this allocator.
+   cat::str_view formatted = cat::fmt(allocator, "a{}b", 10).verify();
+   cat::verify(cat::compare_strings(formatted, "a10b"));
+};
+
+test(size_class_allocator_known_zero) {
+   cat::size_class_allocator allocator;
+
+   // A block bumped out of a fresh slab is known to be zero.
+   cat::span<int4> fresh = allocator.xcalloc_multi<int4>(8u);
+   cat::verify(allocator.is_known_zero(fresh.data(), 32u));
+   cat::verify(fresh[7] == 0);
+   fresh[7] = 1;
+   allocator.free(fresh);
+
+   // A reused block is not known to be zero, so `calloc` zeros it.
+   cat::span<int4> reused = allocator.xcalloc_multi<int4>(8u);
+   cat::verify(reused.data() == fresh.data());
+   cat::verify(!allocator.is_known_zero(reused.data(), 32u));
+   cat::verify(reused[7] == 0);
+   allocator.free(reused);
+
+   // Large allocations are freshly mapped pages.
+   cat::span<int4> large = allocator.xcalloc_multi<int4>(100'000u);
+   cat::verify(allocator.is_known_zero(large.data(), 400'000u));
+   cat::verify(large[99'999] == 0);
+   allocator.free(large);
+
+   // Moving an allocator keeps track of its fresh block.
+   cat::span<int4> moved_fresh = allocator.xalloc_multi<int4>(16u);
+   cat::size_class_allocator moved = cat::move(allocator);
+   cat::verify(moved.is_known_zero(moved_fresh.data(), 64u));
+   moved.free(moved_fresh);
+}
+
+test(size_class_allocator_threads) {
+   cat::size_class_allocator allocator;
+   p_shared_allocator = &allocator;
+   cat::page_allocator pager;
+
+   cat::thread threads[thread_count.raw];
+   for (cat::thread& thread : threads) {
+      thread.spawn(pager, 16_uki, 2_uki, &churn_size_classes).verify();
+   }
+   for (cat::thread& thread : threads) {
+      thread.join().verify();
+   }
+
+   // Memory can be freed by a thread other than the one which allocated it.
+   next_thread_id = 0;
+   cat::thread freeing_threads[thread_count.raw];
+   for (cat::thread& thread : freeing_threads) {
+      thread.spawn(pager, 16_uki, 2_uki, &free_handed_off).verify();
+   }
+   for (cat::thread& thread : freeing_threads) {
+      thread.join().verify();
+   }
+
+   // Blocks which were flushed from threads' caches are reused by the main
+   // thread, which allocates from the shared size classes.
+   int8* p_reused = allocator.xalloc<int8>(1);
+   cat::verify(!allocator.is_known_zero(p_reused, sizeof(int8)));
+   cat::verify(*p_reused == 1);
+   allocator.free(p_reused);
+}
@@ -0,0 +1,62 @@
+#include <cat/slab_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+test(slab_allocator) {
+   cat::is_allocator auto allocator = cat::make_slab_allocator<16u, 64u>();
+
+   // Slots are allocated densely from the front of a slab.
+   int4* p_first = allocator.xalloc<int4>(1);
+   int4* p_second = allocator.xalloc<int4>(2);
+   cat::verify(cat::uintptr<void>(p_second) - cat::uintptr<void>(p_first)
+               == 16u);
+
+   // A freed slot is the first one reused.
+   allocator.free(p_first);
+   int4* p_third = allocator.xalloc<int4>(3);
+   cat::verify(p_third == p_first);
+   cat::verify(*p_second == 2);
+
+   // Several contiguous slots can be allocated together, and they skip past
+   // any gap which is too small. 12 `int4` fill 3 slots.
+   allocator.free(p_third);
+   cat::span<int4> run = allocator.xalloc_multi<int4>(12u);
+   cat::verify(cat::uintptr<void>(run.data()) > cat::uintptr<void>(p_second));
+   run[11] = 1;
+
+   // A run can grow in place into the free slots after it.
+   cat::span<int4> grown = allocator.xrealloc_multi(run.data(), 12u, 16u);
+   cat::verify(grown.data() == run.data());
+   cat::verify(grown[11] == 1);
+
+   // The gap at the front of the slab is still used for a single slot.
+   int4* p_gap = allocator.xalloc<int4>(4);
+   cat::verify(p_gap == p_first);
+
+   // Fill the rest of this slab.
+   for (idx i = 6u; i < 64u; ++i) {
+      auto _ = allocator.xalloc<int4>();
+   }
+
+   // Releasing the slab frees all of its slots at once.
+   allocator.release_slab(p_second);
+   cat::verify(allocator.xalloc<int4>() == p_first);
+
+   // Resetting frees every slot in every slab.
+   allocator.reset();
+   cat::verify(allocator.xalloc<int4>() == p_first);
+
+   // When every slab is full, a new one is mapped.
+   for (idx i = 1u; i < 64u; ++i) {
+      auto _ = allocator.xalloc<int4>();
+   }
+   int4* p_new_slab = allocator.xalloc<int4>();
+   cat::verify(cat::uintptr<void>(p_new_slab) < cat::uintptr<void>(p_first)
+               || cat::uintptr<void>(p_new_slab)
+                     >= cat::uintptr<void>(p_first)
+                           + cat::slab_allocator<16u, 64u>::slab_bytes);
+
+   // Allocations larger than a slab fail.
+   cat::verify(!allocator.alloc_multi<cat::byte>(64u * 16u + 1u).has_value());
+}
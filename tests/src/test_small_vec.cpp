@@ -0,0 +1,75 @@
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+#include <cat/small_vec>
+#include <cat/static_vec>
+#include <cat/stats_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+test(small_vec) {
+   // Initialize an allocator.
+   cat::page_allocator pager;
+   cat::span page = pager.alloc_multi<cat::byte>(4_uki).verify();
+   defer {
+      pager.free(page);
+   };
+   auto linear = cat::make_linear_allocator(page);
+   auto allocator = cat::make_stats_allocator(linear);
+
+   // Up to 4 elements are stored inline, without allocating.
+   cat::small_vec vector = cat::make_small_vec<int4, 4u>(allocator);
+   for (int4 i = 0; i < 4; ++i) {
+      vector.push_back(i).verify();
+   }
+   cat::verify(vector.is_inline());
+   cat::verify(vector.size() == 4);
+   cat::verify(allocator.stats().allocations == 0u);
+
+   // The 5th element overflows into allocated storage.
+   vector.push_back(4).verify();
+   cat::verify(!vector.is_inline());
+   cat::verify(vector.capacity() >= 8);
+   cat::verify(allocator.stats().allocations == 1u);
+   cat::verify(vector[0] == 0);
+   cat::verify(vector[4] == 4);
+
+   // Moving a `small_vec` takes its allocated storage.
+   cat::small_vec moved = cat::move(vector);
+   cat::verify(!moved.is_inline());
+   cat::verify(moved.size() == 5);
+   cat::verify(vector.is_inline());
+   cat::verify(vector.size() == 0);
+
+   // Moving an inline `small_vec` relocates its elements.
+   cat::small_vec inline_vector = cat::make_small_vec<int4, 4u>(allocator);
+   cat::vec const range = cat::make_vec<int4>(linear, 1, 2, 3).verify();
+   inline_vector.append_range(range).verify();
+   cat::small_vec inline_moved = cat::move(inline_vector);
+   cat::verify(inline_moved.is_inline());
+   cat::verify(inline_moved[2] == 3);
+
+   inline_moved.erase(0, 1);
+   cat::verify(inline_moved.size() == 2);
+   cat::verify(inline_moved[0] == 2);
+}
+
+test(static_vec) {
+   cat::static_vec<int4, 3u> vector;
+   cat::verify(vector.size() == 0);
+   cat::verify(vector.capacity() == 3);
+
+   vector.push_back(1).verify();
+   int4& emplaced = vector.emplace_back(2).verify();
+   cat::verify(emplaced == 2);
+   vector.push_back(3).verify();
+
+   // A `static_vec` cannot grow beyond its capacity.
+   cat::verify(!vector.push_back(4).has_value());
+   cat::verify(vector.is_full());
+
+   vector.pop_back();
+   vector.erase(0, 1);
+   cat::verify(vector.size() == 1);
+   cat::verify(vector[0] == 2);
+}
@@ -0,0 +1,104 @@
+#include <cat/atomic>
+#include <cat/page_allocator>
+#include <cat/spsc_ring>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+using ring_type = cat::spsc_ring<idx, cat::page_allocator>;
+
+constexpr idx message_count = 100'000u;
+
+// Threads cannot take arguments yet, so they share this global.
+constinit ring_type* p_shared_ring = nullptr;
+
+// Push every message, one at a time and then in batches, spinning while the
+// ring is full.
+[[gnu::no_sanitize_address]]
+void
+produce() {
+   idx next;
+   while (next < message_count / 2u) {
+      if (p_shared_ring->push(next).has_value()) {
+         ++next;
+      } else {
+         cat::relax_cpu();
+      }
+   }
+
+   idx batch[64];
+   while (next < message_count) {
+      idx batch_size;
+      for (; batch_size < 64u && next + batch_size < message_count;
+           ++batch_size) {
+         batch[batch_size.raw] = next + batch_size;
+      }
+      idx pushed;
+      while (pushed < batch_size) {
+         pushed += p_shared_ring->push_n(batch + pushed.raw,
+                                         batch_size - pushed);
+      }
+      next += batch_size;
+   }
+}
+
+}  // namespace
+
+test(spsc_ring) {
+   cat::page_allocator allocator;
+   ring_type ring = cat::make_spsc_ring<idx>(allocator, 8u).verify();
+   cat::verify(ring.capacity() == 8u);
+   cat::verify(ring.is_empty());
+
+   // A full ring rejects pushes, and an empty ring rejects pops.
+   for (idx i; i < 8u; ++i) {
+      ring.push(i).verify();
+   }
+   cat::verify(!ring.push(8u).has_value());
+   cat::verify(ring.size() == 8u);
+   cat::verify(ring.pop().verify() == 0u);
+   ring.push(8u).verify();
+
+   // Batches wrap around the end of the storage.
+   idx popped[8];
+   cat::verify(ring.pop_n(popped, 8u) == 8u);
+   for (idx i; i < 8u; ++i) {
+      cat::verify(popped[i.raw] == i + 1u);
+   }
+   cat::verify(!ring.pop().has_value());
+   idx const pushed[10] = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+   cat::verify(ring.push_n(pushed, 10u) == 8u);
+   cat::verify(ring.pop_n(popped, 4u) == 4u);
+   cat::verify(popped[3] == 3u);
+   cat::verify(ring.push_n(pushed + 8, 2u) == 2u);
+   cat::verify(ring.pop_n(popped, 8u) == 6u);
+   cat::verify(popped[0] == 4u);
+   cat::verify(popped[5] == 9u);
+
+   // Pass messages from another thread in order.
+   ring_type shared_ring = cat::make_spsc_ring<idx>(allocator, 256u).verify();
+   p_shared_ring = &shared_ring;
+   cat::thread producer;
+   producer.spawn(allocator, 64_uki, 4_uki, &produce).verify();
+
+   idx expected;
+   while (expected < message_count) {
+      if (expected % 2u == 0u) {
+         cat::maybe message = shared_ring.pop();
+         if (message.has_value()) {
+            cat::verify(message.value() == expected);
+            ++expected;
+         }
+      } else {
+         idx const count = shared_ring.pop_n(popped, 8u);
+         for (idx i; i < count; ++i) {
+            cat::verify(popped[i.raw] == expected);
+            ++expected;
+         }
+      }
+   }
+   producer.join().verify();
+   cat::verify(shared_ring.is_empty());
+}
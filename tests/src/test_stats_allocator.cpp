@@ -0,0 +1,101 @@
+#include <cat/format>
+#include <cat/page_allocator>
+#include <cat/stats_allocator>
+#include <cat/vec>
+
+#include "../unit_tests.hpp"
+
+test(stats_allocator) {
+   cat::page_allocator pager;
+   cat::is_allocator auto allocator = cat::make_stats_allocator(pager);
+
+   int4* p_one = allocator.xalloc<int4>(1);
+   cat::span<int8> many = allocator.xalloc_multi<int8>(100u);
+   cat::verify(allocator.stats().allocations == 2u);
+   // Live bytes are counted in the pages which hold them.
+   cat::verify(allocator.stats().live_bytes == 2u * pager.page_bytes);
+
+   // 4 bytes are fewer than 8 bytes, and 800 bytes are fewer than 1024
+   // bytes.
+   cat::verify(allocator.stats().size_histogram[3] == 1u);
+   cat::verify(allocator.stats().size_histogram[10] == 1u);
+
+   allocator.free(p_one);
+   allocator.free(many);
+   cat::verify(allocator.stats().frees == 2u);
+   cat::verify(allocator.stats().live_bytes == 0u);
+   cat::verify(allocator.stats().peak_live_bytes == 2u * pager.page_bytes);
+
+   allocator.print_stats().verify();
+
+   allocator.clear_stats();
+   cat::verify(allocator.stats().allocations == 0u);
+}
+
+test(stats_allocator_call_sites) {
+   cat::page_allocator pager;
+   cat::is_allocator auto allocator = cat::make_stats_allocator<true>(pager);
+
+   cat::vec numbers = cat::make_vec<int4>(allocator);
+   for (int4 i; i < 100; ++i) {
+      numbers.push_back(i).verify();
+   }
+   cat::verify(allocator.call_sites().size() >= 1u);
+   cat::idx const vec_sites = allocator.call_sites().size();
+
+   cat::span<int4> first = allocator.xalloc_multi<int4>(1u);
+   cat::span<int4> second = allocator.xalloc_multi<int4>(2u);
+   cat::verify(allocator.call_sites().size() == vec_sites + 2u);
+   cat::verify(allocator.call_sites()[vec_sites].allocations == 1u);
+   cat::verify(allocator.call_sites()[vec_sites].bytes == 4u);
+   cat::verify(allocator.call_sites()[vec_sites + 1u].bytes == 8u);
+
+   // Allocations from the same call site are counted together.
+   for (idx i; i < 3u; ++i) {
+      allocator.free(allocator.xalloc_multi<int4>(1u));
+   }
+   cat::verify(allocator.call_sites().size() == vec_sites + 3u);
+   cat::verify(allocator.call_sites()[vec_sites + 2u].allocations == 3u);
+
+   // Single objects are counted, but not attributed to a call site.
+   int4* p_number = allocator.xalloc<int4>(1);
+   cat::verify(allocator.call_sites().size() == vec_sites + 3u);
+
+   allocator.free(p_number);
+   allocator.free(first);
+   allocator.free(second);
+   allocator.print_stats().verify();
+}
+
+test(stats_allocator_bytes) {
+   cat::page_allocator pager;
+   cat::is_allocator auto allocator = cat::make_stats_allocator(pager);
+
+   // Containers of single bytes allocate through `.allocate()` and
+   // `.allocate_feedback()`.
+   cat::str_view formatted = cat::fmt(allocator, "a{}b", 10).verify();
+   cat::verify(cat::compare_strings(formatted, "a10b"));
+   cat::verify(allocator.stats().allocations >= 1u);
+
+   // Destroying containers returns the live bytes to where they were,
+   // although a `vec` frees its capacity rather than its size.
+   cat::idx const live_bytes = allocator.stats().live_bytes;
+   {
+      cat::vec chars = cat::make_vec<char>(allocator);
+      for (char c = 'a'; c <= 'z'; ++c) {
+         chars.push_back(c).verify();
+      }
+      cat::verify(chars.size() == 26);
+      cat::verify(chars[25] == 'z');
+
+      cat::vec bytes = cat::make_vec<cat::byte>(allocator);
+      for (idx i; i < 64u; ++i) {
+         bytes.push_back(cat::byte(i.raw)).verify();
+      }
+      cat::verify(bytes.size() == 64);
+      cat::verify(allocator.stats().live_bytes >= live_bytes + 26u + 64u);
+
+      chars.erase(2, 26);
+   }
+   cat::verify(allocator.stats().live_bytes == live_bytes);
+}
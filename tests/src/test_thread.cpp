@@ -28,6 +28,22 @@ function() {
    cat::verify(tls2 == 5);
 }
 
+// Scratch allocations are rewound when their scope exits, so the arena can be
+// filled repeatedly.
+[[gnu::no_sanitize_address]]
+void
+use_scratch() {
+   cat::linear_allocator& scratch = cat::this_thread::scratch();
+   for (idx i = 0; i < 3; ++i) {
+      cat::linear_allocator::scope_guard guard(scratch);
+      cat::span buffer = scratch.alloc_multi<cat::byte>(1_uki).verify();
+      cat::verify(buffer.size() == 1_uki);
+   }
+   // The scratch arena is smaller than its thread-local buffer.
+   cat::verify(!scratch.alloc_multi<cat::byte>(2_uki).has_value());
+   ++atomic;
+}
+
 }  // namespace
 
 test(thread) {
@@ -67,3 +83,15 @@ test(thread) {
    // threads[3].join().verify();
    cat::verify(atomic.load() == 7);
 }
+
+test(thread_scratch) {
+   cat::thread scratch_thread;
+   cat::page_allocator allocator;
+   atomic = 0;
+   scratch_thread.spawn(allocator, 2_uki, 2_uki, &use_scratch).verify();
+   scratch_thread.join().verify();
+   // `use_scratch()` only increments this after all of its checks pass.
+   while (atomic.load() != 1) {
+      cat::relax_cpu();
+   }
+}
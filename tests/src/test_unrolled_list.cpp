@@ -0,0 +1,94 @@
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+#include <cat/stats_allocator>
+#include <cat/string>
+#include <cat/unrolled_list>
+
+#include "../unit_tests.hpp"
+
+test(unrolled_list) {
+   // Initialize an allocator.
+   cat::page_allocator pager;
+   cat::span page = pager.alloc_multi<cat::byte>(4_uki).verify();
+   defer {
+      pager.free(page);
+   };
+   auto linear = cat::make_linear_allocator(page);
+   auto allocator = cat::make_stats_allocator(linear);
+
+   // Elements fill one node before another is linked.
+   cat::unrolled_list list = cat::make_unrolled_list<int4, 4u>(allocator);
+   for (int4 i = 0; i < 4; ++i) {
+      list.push_back(i).verify();
+   }
+   cat::verify(list.node_count() == 1);
+   list.push_back(4).verify();
+   list.push_front(-1).verify();
+   cat::verify(list.node_count() == 3);
+   cat::verify(list.size() == 6);
+   cat::verify(list.front() == -1);
+   cat::verify(list.back() == 4);
+
+   // Iteration visits every element in order.
+   int4 expected = -1;
+   for (int4& value : list) {
+      cat::verify(value == expected);
+      ++expected;
+   }
+   cat::verify(expected == 5);
+
+   // Inserting into a full node splits it.
+   auto it = list.begin();
+   ++it;
+   ++it;
+   auto inserted = list.insert(it, 10).verify();
+   cat::verify(*inserted == 10);
+   cat::verify(list.node_count() == 4);
+   cat::verify(list.size() == 7);
+   expected = -1;
+   int4 visited = 0;
+   for (int4& value : list) {
+      if (visited == 2) {
+         cat::verify(value == 10);
+      } else {
+         cat::verify(value == expected);
+         ++expected;
+      }
+      ++visited;
+   }
+   cat::verify(visited == 7);
+
+   // Erasing returns the following element, and merges sparse nodes.
+   auto next = list.erase(inserted);
+   cat::verify(*next == 1);
+   cat::verify(list.size() == 6);
+   list.pop_front();
+   list.pop_back();
+   cat::verify(list.front() == 0);
+   cat::verify(list.back() == 3);
+   cat::verify(list.node_count() == 2);
+
+   // Cleared nodes are reused without allocating.
+   idx const allocations = allocator.stats().allocations;
+   list.clear();
+   cat::verify(list.is_empty());
+   for (int4 i = 0; i < 8; ++i) {
+      list.push_back(i).verify();
+   }
+   cat::verify(allocator.stats().allocations == allocations);
+
+   // Moving an `unrolled_list` takes its nodes.
+   cat::unrolled_list moved = cat::move(list);
+   cat::verify(moved.size() == 8);
+   cat::verify(list.size() == 0);
+   cat::verify(moved.back() == 7);
+
+   // Elements are constructed in place from their arguments.
+   cat::unrolled_list<cat::str_view, decltype(allocator), 2u> strings =
+      cat::make_unrolled_list<cat::str_view, 2u>(allocator);
+   strings.emplace_back("b").verify();
+   strings.emplace_front("a").verify();
+   strings.emplace_back("c").verify();
+   cat::verify(cat::compare_strings(strings.front(), "a"));
+   cat::verify(cat::compare_strings(strings.back(), "c"));
+}
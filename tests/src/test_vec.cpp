@@ -6,7 +6,19 @@
 
 namespace {
 inline constinit idx destructor_count = 0u;
-}
+
+// A non-trivial type which `vec` relocates with `cat::copy_memory()`.
+struct relocatable_counter {
+   int4 value;
+
+   ~relocatable_counter() {
+      ++destructor_count;
+   }
+};
+}  // namespace
+
+template <>
+constexpr bool cat::is_trivially_relocatable<relocatable_counter> = true;
 
 // Test that `vec` works in a `constexpr` context.
 consteval auto
@@ -143,6 +155,39 @@ test(vec) {
 
    // TODO: Test insert iterators.
 
+   // Test bulk operations.
+   cat::vec bulk_vector = cat::make_vec<int4>(allocator);
+   cat::vec const range = cat::make_vec<int4>(allocator, 1, 2, 3).verify();
+   bulk_vector.append_range(range).verify();
+   bulk_vector.append_range(range).verify();
+   cat::verify(bulk_vector.size() == 6);
+   cat::verify(bulk_vector[3] == 1);
+   cat::verify(bulk_vector[5] == 3);
+
+   // Insert into the middle, which shifts the tail up.
+   bulk_vector.insert(1, range).verify();
+   cat::verify(bulk_vector.size() == 9);
+   cat::verify(bulk_vector[0] == 1);
+   cat::verify(bulk_vector[1] == 1);
+   cat::verify(bulk_vector[3] == 3);
+   cat::verify(bulk_vector[4] == 2);
+   cat::verify(bulk_vector[8] == 3);
+
+   // Erase from the middle, which shifts the tail down.
+   bulk_vector.erase(1, 4);
+   cat::verify(bulk_vector.size() == 6);
+   cat::verify(bulk_vector[1] == 2);
+   cat::verify(bulk_vector[5] == 3);
+
+   int4& emplaced = bulk_vector.emplace_back(7).verify();
+   cat::verify(emplaced == 7);
+   cat::verify(bulk_vector[6] == 7);
+
+   // This is the most recent allocation, so it shrinks in place.
+   bulk_vector.shrink_to_fit().verify();
+   cat::verify(bulk_vector.capacity() == 7);
+   cat::verify(bulk_vector[6] == 7);
+
    // Test algorithms.
    cat::vec origin_vector = cat::make_vec_filled(allocator, 6, 1).verify();
    auto copy_vector = cat::make_vec_filled(allocator, 6, 0).verify();
@@ -219,4 +264,42 @@ test(vec) {
       cat::vec _ = cat::make_vec<foo>(allocator, foo{}, foo{}, foo{}).verify();
    }
    cat::assert(destructor_count == 3);
+
+   // Erasing non-trivially relocatable elements destroys each one once.
+   destructor_count = 0u;
+   {
+      cat::vec foos = cat::make_vec<foo>(allocator);
+      for (idx i; i < 4u; ++i) {
+         foo& _ = foos.emplace_back().verify();
+      }
+      foos.erase(0, 2);
+      cat::verify(destructor_count == 2);
+      cat::verify(foos.size() == 2);
+   }
+   cat::verify(destructor_count == 4);
+
+   // Shrinking relocatable elements out of place neither destroys the old
+   // copies nor leaks the old buffer's extra capacity.
+   destructor_count = 0u;
+   cat::span counter_page = pager.xalloc_multi<cat::byte>(256u);
+   defer {
+      pager.free(counter_page);
+   };
+   auto counter_allocator = cat::make_linear_allocator(counter_page);
+   {
+      cat::vec counters = cat::make_vec<relocatable_counter>(counter_allocator);
+      counters.reserve(8u).verify();
+      for (int4 i; i < 3; ++i) {
+         relocatable_counter& _ = counters.emplace_back(i).verify();
+      }
+      // Another allocation prevents shrinking in place.
+      int4* p_blocker = counter_allocator.xalloc<int4>(0);
+      counters.shrink_to_fit().verify();
+      cat::verify(counters.size() == 3);
+      cat::verify(counters.capacity() == 3);
+      cat::verify(counters[2].value == 2);
+      cat::verify(destructor_count == 0);
+      counter_allocator.free(p_blocker);
+   }
+   cat::verify(destructor_count == 3);
 }